@@ -0,0 +1,67 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace prism
+{
+/**
+ * A non-owning view into contiguous or strided memory
+ * This allows data stored in a solver's own containers to be passed to PRISM
+ * without any copies being made
+ * Ex: the electron temperature stored in every third entry of a state vector
+ * can be viewed with ArrayView<const double>(state.data(), n, 3)
+ */
+template <typename T>
+class ArrayView
+{
+public:
+  /**
+   * @param data pointer to the first entry in the view
+   * @param size the number of entries in the view
+   * @param stride the distance between consecutive entries in the view
+   */
+  ArrayView(T * data, const std::size_t size, const std::size_t stride = 1)
+    : _data(data), _size(size), _stride(stride)
+  {
+  }
+  /**
+   * Creates a view of an entire container with contiguous storage (std::vector, std::array)
+   * @param container the container being viewed
+   */
+  template <typename Container,
+            typename = std::enable_if_t<
+                std::is_convertible_v<decltype(std::declval<Container &>().data()), T *>>>
+  ArrayView(Container & container) : _data(container.data()), _size(container.size()), _stride(1)
+  {
+  }
+
+  /** Access to the ith entry in the view */
+  T & operator[](const std::size_t i) const { return _data[i * _stride]; }
+  /** Self descriptive getter method */
+  std::size_t size() const { return _size; }
+  /** Self descriptive getter method */
+  std::size_t stride() const { return _stride; }
+  /** Self descriptive getter method */
+  T * data() const { return _data; }
+
+private:
+  /// the first entry in the view
+  T * _data;
+  /// the number of entries in the view
+  std::size_t _size;
+  /// the distance between entries in the view
+  std::size_t _stride;
+};
+}
@@ -9,10 +9,15 @@
 //* ALL RIGHTS RESERVED
 //*
 #pragma once
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <unordered_map>
 
+#include "FileStamp.h"
+#include "MappedFile.h"
+
 namespace prism
 {
 
@@ -23,60 +28,92 @@ namespace prism
 class BibTexHelper
 {
 public:
-  /** Static function to get the instance of the singleton instance */
+  /**
+   * Static function to get the instance shared by the default NetworkParser
+   * parsers created with their own constructor own a separate helper
+   */
   static BibTexHelper & instance();
-  /** Empties all of the cite keys that are currently in the BibTexHelper */
+  /**
+   * Empties all of the cite keys that are currently in the BibTexHelper
+   * the keys found in each file are kept and reused if the file is collected again
+   * without being modified
+   */
   void clear();
   /**
    * Checks to see if a cite key belongs to a give bib file
+   * this is safe to call from several threads at once
    * @param file bib file that is being checked
    * @param citekey the citekey you want to check to see if it exists
    */
   void checkCiteKey(const std::string & file, const std::string & citekey);
 
 #ifdef TESTING
-  void collectReferences(const std::string & bibfile);
+  void collectReferences(const std::string & bibfile, const bool lazy = false);
 #endif
 
 private:
   /// the NetworkParser is a friend so that it can call private functions
   friend class NetworkParser;
-  /** Private constructor to prevent instantiation, needed to make this a singleton */
+  /** Private constructor, only the NetworkParser creates helpers */
   BibTexHelper() {}
 
-  /** Deleting these methods to ensure the class is a singleton */
+  /** Deleting these methods so each parser has its own helper */
   ///@{
   BibTexHelper(const BibTexHelper &) = delete;
   BibTexHelper & operator=(const BibTexHelper &) = delete;
   ///@}
 
-  /// the instance of itself that this class holds
-  static BibTexHelper * _instance;
+  /** Everything known about the cite keys in a single bib file */
+  struct BibFile
+  {
+    /// the state of the file when it was read
+    FileStamp stamp;
+    /// whether or not every entry in the file has been scanned into keys
+    bool scanned = false;
+    /// every citekey in the file, only filled once the file has been scanned
+    std::unordered_set<std::string> keys;
+    /// the contents of the file, only held while lazily checked keys are being searched for
+    std::unique_ptr<MappedFile> contents;
+    /// whether or not each of the keys searched for lazily was found
+    std::unordered_map<std::string, bool> lookups;
+    /// guards the lazy lookups since reactions check their references in parallel
+    std::mutex mutex;
+  };
 
   /**
-   * This is where we are going to store all of the citekeys
-   * that are available in each bib file
+   * Every bib file that has been collected, kept through clear() so that unmodified
+   * files are never scanned twice
    */
-  std::unordered_map<std::string, std::unordered_set<std::string>> _refs;
+  std::unordered_map<std::string, std::shared_ptr<BibFile>> _files;
   /**
-   * Reads the provided bib file and collects all of the cite keys and places
-   * them into the refs set
-   * @param bibfile the path to the bibtex file
-   * @throws invalid_argument if there is an issue with the bibtex file and citekeys cannot be found
-   * @throws invalid_argument if a key found in the bibfile has already been added to the set
-   * @throws invalid_argument if the provided bib file is not found
+   * This is where we are going to store all of the citekeys
+   * that are available in each bib file
    */
+  std::unordered_map<std::string, std::shared_ptr<BibFile>> _refs;
 
-#ifndef TESTING
   /**
    * Method parses a bib file and collects all of the citekeys
-   * that exist in that file
-   * @param the file holds all of the citeykeys to be collected
+   * that exist in that file. Only the '@type{key,' header of each entry is looked at
+   * @param bibfile the file holds all of the citeykeys to be collected
+   * @param lazy when true the file is not scanned, each citekey is searched for in the file
+   * the first time it is checked, malformed entries are not reported and repeated citekeys
+   * are only reported for the keys that are checked
    * @throws invalid_argument when there is an error in the formatting of
    * the entry that prevents collection of the citekey
    * @throws invalid_argument when the same cite key appears twice in the bib file
+   * @throws invalid_argument if the provided bib file is not found
    */
-  void collectReferences(const std::string & bibfile);
+#ifndef TESTING
+  void collectReferences(const std::string & bibfile, const bool lazy = false);
 #endif
+  /**
+   * Searches the contents of a lazily collected bib file for the entry of a citekey
+   * @param file the name of the bib file
+   * @param bib the bib file
+   * @param citekey the key to search for
+   * @throws invalid_argument when the entry of the citekey appears twice in the bib file
+   * @returns whether or not there is an entry for the citekey
+   */
+  static bool findCiteKey(const std::string & file, BibFile & bib, const std::string & citekey);
 };
 }
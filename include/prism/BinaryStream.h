@@ -0,0 +1,195 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace prism
+{
+/**
+ * Computes the 64 bit FNV-1a hash of a block of bytes
+ * @param data the bytes to hash
+ * @param hash the hash to continue from, this allows several blocks to be hashed together
+ */
+inline std::uint64_t
+fnv1a(const std::string_view data, std::uint64_t hash = 0xcbf29ce484222325ULL)
+{
+  for (const char c : data)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/**
+ * Hashes the contents of a file with fnv1a()
+ * @param file the file to hash
+ * @param hash where the hash is stored
+ * @return false if the file could not be read
+ */
+bool hashFile(const std::string & file, std::uint64_t & hash);
+
+/**
+ * Appends values to a buffer in the native binary representation
+ * this is used to write the network cache and should be paired with BinaryReader
+ */
+class BinaryWriter
+{
+public:
+  /** Writes a value which can be copied byte for byte */
+  template <typename T>
+  void write(const T & value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be written");
+    _buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  /** Writes a string prefixed by its length */
+  void write(const std::string & value)
+  {
+    write<std::uint64_t>(value.size());
+    _buffer.append(value);
+  }
+  /** Writes a vector prefixed by its length */
+  template <typename T>
+  void write(const std::vector<T> & values)
+  {
+    write<std::uint64_t>(values.size());
+    if constexpr (std::is_trivially_copyable_v<T>)
+      _buffer.append(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+    else
+      for (const auto & value : values)
+        write(value);
+  }
+  /** Writes a map prefixed by its length */
+  template <typename K, typename V>
+  void write(const std::map<K, V> & values)
+  {
+    write<std::uint64_t>(values.size());
+    for (const auto & it : values)
+    {
+      write(it.first);
+      write(it.second);
+    }
+  }
+
+  /** Self descriptive getter method */
+  const std::string & buffer() const { return _buffer; }
+
+private:
+  /// the bytes which have been written
+  std::string _buffer;
+};
+
+/**
+ * Reads values from a buffer that was created with a BinaryWriter
+ * values must be read in the same order they were written
+ */
+class BinaryReader
+{
+public:
+  /** @param data the bytes to read from, these must outlive the reader */
+  BinaryReader(const std::string_view data) : _data(data), _position(0) {}
+
+  /**
+   * Reads a value which can be copied byte for byte
+   * @throws invalid_argument if there is not enough data left
+   */
+  template <typename T>
+  T read()
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read");
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+  /**
+   * Reads a string that was written with its length
+   * @throws invalid_argument if there is not enough data left
+   */
+  std::string readString()
+  {
+    const auto size = read<std::uint64_t>();
+    return std::string(take(size), size);
+  }
+  /**
+   * Reads a vector that was written with its length
+   * @throws invalid_argument if there is not enough data left
+   */
+  template <typename T>
+  std::vector<T> readVector()
+  {
+    const auto size = read<std::uint64_t>();
+    std::vector<T> values;
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+      values.reserve(std::min<std::uint64_t>(size, remaining()));
+      for (std::uint64_t i = 0; i < size; ++i)
+        values.push_back(readString());
+    }
+    else
+    {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types can be read");
+      if (size > remaining() / sizeof(T))
+        throw std::invalid_argument("Unexpected end of binary data");
+      values.resize(size);
+      if (size != 0)
+        std::memcpy(values.data(), take(size * sizeof(T)), size * sizeof(T));
+    }
+    return values;
+  }
+  /**
+   * Reads a map that was written with its length
+   * @param read_key reads a single key
+   * @param read_value reads a single value
+   * @throws invalid_argument if there is not enough data left
+   */
+  template <typename Map, typename ReadKey, typename ReadValue>
+  Map readMap(ReadKey read_key, ReadValue read_value)
+  {
+    const auto size = read<std::uint64_t>();
+    Map values;
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+      auto key = read_key();
+      values.emplace(std::move(key), read_value());
+    }
+    return values;
+  }
+
+  /** The number of bytes that have not been read */
+  std::size_t remaining() const { return _data.size() - _position; }
+
+private:
+  /// the bytes being read
+  const std::string_view _data;
+  /// the position of the next byte to read
+  std::size_t _position;
+
+  /** Advances past size bytes and returns a pointer to the first of them */
+  const char * take(const std::uint64_t size)
+  {
+    if (size > remaining())
+      throw std::invalid_argument("Unexpected end of binary data");
+    const char * start = _data.data() + _position;
+    _position += size;
+    return start;
+  }
+};
+}
@@ -0,0 +1,49 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "PrismConstants.h"
+
+namespace prism
+{
+/**
+ * Identifies a reaction by the process it describes rather than how it was written
+ * Each side is a list of species ids and the number of times they appear sorted by id,
+ * so "A + B -> C" and "B + A -> C" have the same key
+ */
+struct CanonicalReactionKey
+{
+  /// the id and multiplicity of every reactant
+  std::vector<std::pair<SpeciesId, unsigned int>> reactants;
+  /// the id and multiplicity of every product
+  std::vector<std::pair<SpeciesId, unsigned int>> products;
+
+  bool operator==(const CanonicalReactionKey & other) const
+  {
+    return reactants == other.reactants && products == other.products;
+  }
+  bool operator!=(const CanonicalReactionKey & other) const { return !(*this == other); }
+};
+}
+
+template <>
+struct std::hash<prism::CanonicalReactionKey>
+{
+  /**
+   * Hash based on the ids and multiplicities of the species on both sides of the reaction
+   * @param key the key of the reaction
+   */
+  size_t operator()(const prism::CanonicalReactionKey & key) const;
+};
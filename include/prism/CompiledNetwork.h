@@ -0,0 +1,205 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ArrayView.h"
+#include "PrismConstants.h"
+
+namespace prism
+{
+class Reaction;
+class Species;
+
+/**
+ * One block of reactions (rate-based or xsec-based) stored as flat arrays indexed by reaction id
+ * Variable length data, such as the reactants of each reaction, is stored as one array
+ * for the whole block with an offset array giving where each reaction begins.
+ * None of the accessors allocate
+ */
+class CompiledReactionBlock
+{
+public:
+  /** Creates an empty block */
+  CompiledReactionBlock() : _reactant_offsets(1, 0), _product_offsets(1, 0), _species_offsets(1, 0)
+  {
+  }
+  /**
+   * @param rxns the reactions in the block
+   * @param species every species in the network in id order
+   * @param rate_based whether this is the rate-based block or the xsec-based block
+   */
+  CompiledReactionBlock(const std::vector<std::shared_ptr<Reaction>> & rxns,
+                        const std::vector<std::shared_ptr<Species>> & species,
+                        const bool rate_based);
+
+  /** The number of reaction ids in the block */
+  std::size_t size() const { return _is_elastic.size(); }
+
+  /**
+   * The function parameters (A, n_e, E_e, n_g, E_g) of a reaction
+   * reactions with tabulated data have all parameters set to zero
+   */
+  ArrayView<const double> functionParams(const ReactionId r) const
+  {
+    return ArrayView<const double>(
+        _params.data() + r * NUM_REQUIRED_ARR_PARAMS, NUM_REQUIRED_ARR_PARAMS);
+  }
+  /** One function parameter, A = 0 through E_g = 4, of every reaction */
+  ArrayView<const double> functionParam(const unsigned int param) const
+  {
+    return ArrayView<const double>(_params.data() + param, size(), NUM_REQUIRED_ARR_PARAMS);
+  }
+  /** The change in electron energy for every reaction */
+  ArrayView<const double> deltaEnergyElectron() const { return _delta_eps_e; }
+  /** The change in gas energy for every reaction */
+  ArrayView<const double> deltaEnergyGas() const { return _delta_eps_g; }
+  /** Whether or not a reaction has tabulated data */
+  bool hasTabulatedData(const ReactionId r) const { return _has_tabulated_data[r]; }
+  /** Whether or not a reaction is elastic */
+  bool isElastic(const ReactionId r) const { return _is_elastic[r]; }
+
+  /** The species id of each unique reactant of a reaction */
+  ArrayView<const SpeciesId> reactants(const ReactionId r) const
+  {
+    return range(_reactants, _reactant_offsets, r);
+  }
+  /** The number of times each reactant of a reaction occurs */
+  ArrayView<const unsigned int> reactantCounts(const ReactionId r) const
+  {
+    return range(_reactant_counts, _reactant_offsets, r);
+  }
+  /** The species id of each unique product of a reaction */
+  ArrayView<const SpeciesId> products(const ReactionId r) const
+  {
+    return range(_products, _product_offsets, r);
+  }
+  /** The number of times each product of a reaction occurs */
+  ArrayView<const unsigned int> productCounts(const ReactionId r) const
+  {
+    return range(_product_counts, _product_offsets, r);
+  }
+  /** The id of every reaction in the block a species takes part in */
+  ArrayView<const ReactionId> reactions(const SpeciesId s) const
+  {
+    return range(_species_rxns, _species_offsets, s);
+  }
+  /** The stoichiometric coefficient of a species in each of the reactions it takes part in */
+  ArrayView<const int> stoichiometricCoeffs(const SpeciesId s) const
+  {
+    return range(_species_coeffs, _species_offsets, s);
+  }
+
+  /** Where the reactants of each reaction begin, with size() + 1 entries */
+  const std::vector<std::size_t> & reactantOffsets() const { return _reactant_offsets; }
+  /** Where the products of each reaction begin, with size() + 1 entries */
+  const std::vector<std::size_t> & productOffsets() const { return _product_offsets; }
+  /** Where the reactions of each species begin, with one more entry than species */
+  const std::vector<std::size_t> & speciesOffsets() const { return _species_offsets; }
+
+private:
+  /// the function parameters of every reaction, NUM_REQUIRED_ARR_PARAMS per reaction
+  std::vector<double> _params;
+  /// the change in electron energy of every reaction
+  std::vector<double> _delta_eps_e;
+  /// the change in gas energy of every reaction
+  std::vector<double> _delta_eps_g;
+  /// whether or not each reaction has tabulated data
+  std::vector<bool> _has_tabulated_data;
+  /// whether or not each reaction is elastic
+  std::vector<bool> _is_elastic;
+  /// the reactants of every reaction
+  ///@{
+  std::vector<std::size_t> _reactant_offsets;
+  std::vector<SpeciesId> _reactants;
+  std::vector<unsigned int> _reactant_counts;
+  ///@}
+  /// the products of every reaction
+  ///@{
+  std::vector<std::size_t> _product_offsets;
+  std::vector<SpeciesId> _products;
+  std::vector<unsigned int> _product_counts;
+  ///@}
+  /// the reactions of every species
+  ///@{
+  std::vector<std::size_t> _species_offsets;
+  std::vector<ReactionId> _species_rxns;
+  std::vector<int> _species_coeffs;
+  ///@}
+
+  /** A view of the entries of data that belong to index i */
+  template <typename T>
+  static ArrayView<const T> range(const std::vector<T> & data,
+                                  const std::vector<std::size_t> & offsets,
+                                  const std::size_t i)
+  {
+    return ArrayView<const T>(data.data() + offsets[i], offsets[i + 1] - offsets[i]);
+  }
+};
+
+/**
+ * A frozen copy of everything in the parsed networks that solvers need at runtime
+ * stored in contiguous arrays instead of the graph of Species and Reaction objects
+ * Species data is indexed by species id and reaction data by reaction id.
+ * The snapshot does not change when more networks are parsed, request a new one
+ * from NetworkParser::compiledNetwork() instead. Snapshots are shared so one that is held
+ * by a solver stays valid after the parser moves on
+ */
+class CompiledNetwork
+{
+public:
+  /**
+   * @param species every species in the network in id order
+   * @param rate_based the reactions in the rate-based block
+   * @param xsec_based the reactions in the xsec-based block
+   */
+  CompiledNetwork(const std::vector<std::shared_ptr<Species>> & species,
+                  const std::vector<std::shared_ptr<Reaction>> & rate_based,
+                  const std::vector<std::shared_ptr<Reaction>> & xsec_based);
+
+  /** The number of species in the network */
+  std::size_t numSpecies() const { return _names.size(); }
+  /** The name of every species */
+  const std::vector<std::string> & speciesNames() const { return _names; }
+  /** The mass of every species in kg */
+  ArrayView<const double> masses() const { return _masses; }
+  /** The charge of every species in coulomb */
+  ArrayView<const double> charges() const { return _charges; }
+  /** The charge number of every species */
+  ArrayView<const int> chargeNumbers() const { return _charge_numbers; }
+  /** Whether or not a species is held constant */
+  bool isConstant(const SpeciesId s) const { return _is_constant[s]; }
+  /** The reactions in the rate-based block */
+  const CompiledReactionBlock & rateBased() const { return _rate_based; }
+  /** The reactions in the xsec-based block */
+  const CompiledReactionBlock & xsecBased() const { return _xsec_based; }
+
+private:
+  /// the name of every species
+  std::vector<std::string> _names;
+  /// the mass of every species
+  std::vector<double> _masses;
+  /// the charge of every species
+  std::vector<double> _charges;
+  /// the charge number of every species
+  std::vector<int> _charge_numbers;
+  /// whether or not each species is constant
+  std::vector<bool> _is_constant;
+  /// the reactions in each block
+  ///@{
+  CompiledReactionBlock _rate_based;
+  CompiledReactionBlock _xsec_based;
+  ///@}
+};
+}
@@ -0,0 +1,52 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "PrismConstants.h"
+
+namespace prism
+{
+/**
+ * The number of each element in every species of a network, with a row for every species
+ * (indexed by species id) and a column for every element that appears in the network,
+ * the columns are sorted by element name
+ * Electrons and photons are not elements, they are accounted for by the charge numbers
+ * A reaction conserves mass and charge when its net stoichiometric coefficients multiplied by
+ * every column of the matrix and by the charge numbers sum to zero
+ */
+struct CompositionMatrix
+{
+  /// the name of the element in each column
+  std::vector<std::string> elements;
+  /// the number of each element in each species stored row by row
+  std::vector<unsigned int> counts;
+  /// the charge number of each species
+  std::vector<int> charge_numbers;
+
+  /** The number of rows in the matrix */
+  std::size_t numSpecies() const { return charge_numbers.size(); }
+  /** The number of columns in the matrix */
+  std::size_t numElements() const { return elements.size(); }
+  /**
+   * The number of times an element appears in a species
+   * @param species the id of the species
+   * @param element the column of the element
+   */
+  unsigned int operator()(const SpeciesId species, const std::size_t element) const
+  {
+    return counts[species * elements.size() + element];
+  }
+};
+}
@@ -0,0 +1,75 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace prism
+{
+/**
+ * Reads files which have columns of numeric data seperated by a delimiter
+ * The file is memory mapped and scanned in place, values are parsed straight
+ * out of the mapping with std::from_chars so no intermediate strings are created
+ * Rows are handed back one at a time so that the caller can store them directly
+ * in whatever structure it keeps the data in
+ */
+class DataFileReader
+{
+public:
+  /**
+   * @param file the file which contains the data
+   * @param delimiter the string that seperates the columns
+   * @param num_columns the number of columns allowed in the file
+   * @throws InvalidInput if the file cannot be opened
+   */
+  DataFileReader(const std::string & file,
+                 const std::string & delimiter,
+                 const unsigned int num_columns);
+
+  /**
+   * Parses the next line of the file
+   * @param values pointer to the start of an array with at least numColumns() entries
+   * where the values on the line are stored
+   * @return false when there are no lines left to read
+   * @throws InvalidInput if the line is not valid, the message contains the line number
+   */
+  bool nextLine(double * values);
+  /**
+   * The number of lines in the file, this is intended to be used for reserving
+   * storage before reading and does not check that the lines are valid
+   */
+  std::size_t numLines() const;
+  /** The number of lines that have been read so far */
+  unsigned int lineCount() const { return _line_count; }
+  /** Self descriptive getter method */
+  unsigned int numColumns() const { return _num_columns; }
+
+private:
+  /// the file being read
+  const std::string _file;
+  /// the string that seperates the columns
+  const std::string _delimiter;
+  /// the number of columns required on every line
+  const unsigned int _num_columns;
+  /// the contents of the file
+  MappedFile _map;
+  /// the position of the start of the next line in the file
+  std::size_t _position;
+  /// the number of lines that have been read
+  unsigned int _line_count;
+  /// scratch space for the columns on the current line
+  std::vector<std::string_view> _columns;
+};
+}
@@ -0,0 +1,52 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace prism
+{
+/**
+ * The state of a file at the time it was read
+ * used to find the files which have been modified since they were read
+ */
+struct FileStamp
+{
+  /// the modification time in nanoseconds
+  std::int64_t mtime = -1;
+  /// the size of the file in bytes
+  std::uint64_t size = 0;
+  /// the fnv1a() hash of the contents of the file
+  std::uint64_t hash = 0;
+  /// whether the file was modified so recently that another change may not move the
+  /// modification time, the contents of these files are always hashed when they are checked
+  bool racy = true;
+};
+
+/**
+ * Records the current state of a file
+ * @param file the file to stamp
+ * @param stamp where the state is stored
+ * @return false if the file could not be read
+ */
+bool stampFile(const std::string & file, FileStamp & stamp);
+
+/**
+ * Checks whether a file still has the contents it had when it was stamped
+ * The contents are only hashed when the modification time or size differ, so checking
+ * a file which has not been touched only costs a call to stat
+ * @param file the file to check
+ * @param stamp the previous state of the file, updated to the current state
+ * @return true if the contents of the file are unchanged
+ */
+bool fileUnchanged(const std::string & file, FileStamp & stamp);
+}
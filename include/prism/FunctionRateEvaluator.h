@@ -0,0 +1,109 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "PrismConstants.h"
+
+namespace prism
+{
+class Reaction;
+
+/**
+ * Evaluates the rates of many reactions with function parameters at once
+ * Reactions are grouped by their functional form and their parameters are stored
+ * as structure of arrays so that each group can be evaluated in a single tight loop
+ * Terms that are shared between all reactions, such as ln(T_e) and 1 / T_e,
+ * are only computed once per evaluation
+ */
+class FunctionRateEvaluator
+{
+public:
+  /**
+   * @param rxns the reactions to evaluate, these are typically the lists provided by
+   * NetworkParser::functionRateReactions() or NetworkParser::functionXSecReactions()
+   * @throws invalid_argument if any of the reactions have tabulated data
+   */
+  FunctionRateEvaluator(const std::vector<std::shared_ptr<const Reaction>> & rxns);
+
+  /**
+   * Evaluates all of the reactions at the point T_e and T_g
+   * values are placed in the position of the reaction id, positions in the vector
+   * which belong to other reactions are not modified
+   * the vector will be resized if it is not large enough to hold every reaction id
+   * @param T_e the electron temperature
+   * @param T_g the gas temperature
+   * @param values where the sampled values are stored
+   */
+  void evaluate(const double T_e, const double T_g, std::vector<double> & values) const;
+  /**
+   * Evaluates all of the reactions at the point T_e and T_g
+   * values are stored contiguously in the order provided by reactionIds()
+   * @param T_e the electron temperature
+   * @param T_g the gas temperature
+   * @param values pointer to the start of an array with at least size() entries
+   */
+  void evaluatePacked(const double T_e, const double T_g, double * values) const;
+  /** The number of reactions in the evaluator */
+  std::size_t size() const { return _ids.size(); }
+  /**
+   * The ids of the reactions in the order their values are stored by evaluatePacked()
+   */
+  const std::vector<ReactionId> & reactionIds() const { return _ids; }
+
+private:
+  /**
+   * Evaluates every reaction with pow() rather than the shared logarithms
+   * used when either temperature is not positive so the results match Reaction::sampleData()
+   * @param T_e the electron temperature
+   * @param T_g the gas temperature
+   * @param values pointer to the start of an array with at least size() entries
+   */
+  void evaluateWithPow(const double T_e, const double T_g, double * values) const;
+
+  /**
+   * Storage for the parameters of every reaction with the same functional form
+   * each vector holds one parameter for every reaction in the block
+   */
+  struct ParameterBlock
+  {
+    /// the offset of the block into the packed values
+    std::size_t offset;
+    /// the pre-exponential factor
+    std::vector<double> A;
+    /// the electron temperature exponent
+    std::vector<double> n_e;
+    /// the electron activation energy
+    std::vector<double> E_e;
+    /// the gas temperature exponent
+    std::vector<double> n_g;
+    /// the gas activation energy
+    std::vector<double> E_g;
+
+    std::size_t size() const { return A.size(); }
+  };
+
+  /// the reaction ids in packed order
+  std::vector<ReactionId> _ids;
+  /// the largest reaction id held by the evaluator plus one
+  std::size_t _max_id;
+  /// parameter blocks for each functional form
+  ///@{
+  ParameterBlock _constant;
+  ParameterBlock _partial_1;
+  ParameterBlock _partial_2;
+  ParameterBlock _partial_3;
+  ParameterBlock _full;
+  ///@}
+};
+}
@@ -0,0 +1,188 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace prism
+{
+/**
+ * Remembers where the last lookup in an InterpolationTable landed so that the next
+ * lookup can start its search from there.
+ * Cursors belong to the caller (typically one per cell or per thread) and are never
+ * modified by the table except through the lookup they are passed to
+ * A cursor can be reused between tables but it will not be any faster than a normal lookup
+ */
+struct InterpolationCursor
+{
+  /// the result of the last lookup
+  std::size_t index = 0;
+};
+
+/**
+ * Piecewise linear interpolation table with an acceleration index
+ * The index is built once when the table is created. It divides the range of
+ * the table into buckets (uniform or log-uniform depending on the spread of the data) that each
+ * know the first segment they overlap, and the slope of every segment is precomputed.
+ * A lookup is then a single bucket computation, usually no search at all, and a multiply-add.
+ * Results are identical to a std::lower_bound search followed by linear interpolation
+ */
+class InterpolationTable
+{
+public:
+  /** Creates an empty table */
+  InterpolationTable();
+  /**
+   * @param energies the points where data is provided, must be in ascending order
+   * @param values the data at each of the points
+   */
+  InterpolationTable(const std::vector<double> & energies, const std::vector<double> & values);
+
+  /**
+   * The index of the first point which is not less than x,
+   * this is the same result that std::lower_bound provides
+   * @param x the point being searched for
+   */
+  std::size_t lowerBound(const double x) const
+  {
+    const auto * const e = _energies.data();
+    const std::size_t n = _energies.size();
+    const std::size_t b = bucket(x);
+    // the result is between the starts of this bucket and the next one, this range
+    // usually holds a single point but is searched so that clustered data stays fast
+    const std::size_t lo = _bucket_start[b];
+    const std::size_t hi = b + 1 < _bucket_start.size() ? _bucket_start[b + 1] : n;
+    std::size_t i = std::lower_bound(e + lo, e + hi, x) - e;
+    // guards against rounding in the bucket computation placing x in a neighboring bucket
+    if ((i < n && e[i] < x) || (i > 0 && e[i - 1] >= x))
+      i = std::lower_bound(e, e + n, x) - e;
+    return i;
+  }
+  /**
+   * The index of the first point which is not less than x, this is the same result
+   * that std::lower_bound provides
+   * The search hunts outward from the result of the previous lookup with the cursor,
+   * so points that move slowly through the table are found in constant time
+   * @param x the point being searched for
+   * @param cursor the result of the previous lookup, updated with the new result
+   */
+  std::size_t lowerBound(const double x, InterpolationCursor & cursor) const;
+  /**
+   * Linearly interpolates the data at x
+   * values outside of the range of the table take the value at the nearest end
+   * @param x the point to sample
+   */
+  double interpolate(const double x) const { return interpolateSegment(x, lowerBound(x)); }
+  /**
+   * Linearly interpolates the data at x given the result of lowerBound(x)
+   * @param x the point to sample
+   * @param d2 the index of the first point which is not less than x
+   */
+  double interpolateSegment(const double x, const std::size_t d2) const
+  {
+    if (d2 == 0)
+      return _values.front();
+    if (d2 == _energies.size())
+      return _values.back();
+    const std::size_t d1 = d2 - 1;
+    return _slopes[d1] * (x - _energies[d1]) + _values[d1];
+  }
+
+  /**
+   * Extends the first and last segments of the table past its ends
+   * the result is never allowed to go below zero
+   * @param x a point outside of the table
+   */
+  double extrapolateLinear(const double x) const
+  {
+    const double value = x < _energies.front()
+                             ? _lower_slope * (x - _energies.front()) + _values.front()
+                             : _upper_slope * (x - _energies.back()) + _values.back();
+    return value > 0 ? value : 0;
+  }
+  /**
+   * Extends the data past the ends of the table with a power law through the
+   * two points at that end of the table. When the data at an end is not positive
+   * a power law cannot be fit and the value at that end is used instead
+   * The lower tail is held at the first value wherever the power law is not finite,
+   * at or below zero energy and near zero energy when the exponent is negative
+   * @param x a point outside of the table
+   */
+  double extrapolatePowerLaw(const double x) const
+  {
+    if (x < _energies.front())
+    {
+      if (!(x > 0))
+        return _values.front();
+      const double value = _values.front() * std::pow(x / _energies.front(), _lower_exponent);
+      return std::isfinite(value) ? value : _values.front();
+    }
+    return _values.back() * std::pow(x / _energies.back(), _upper_exponent);
+  }
+
+  /** Self descriptive getter method */
+  double minEnergy() const { return _energies.front(); }
+  /** Self descriptive getter method */
+  double maxEnergy() const { return _energies.back(); }
+  /** Self descriptive getter method */
+  std::size_t size() const { return _energies.size(); }
+  /** Whether or not the table holds any data */
+  bool empty() const { return _energies.empty(); }
+  /** Self descriptive getter method */
+  const std::vector<double> & energies() const { return _energies; }
+  /** Self descriptive getter method */
+  const std::vector<double> & values() const { return _values; }
+  /** Self descriptive getter method */
+  const std::vector<double> & slopes() const { return _slopes; }
+  /** Whether or not the buckets in the index are log-uniformly spaced */
+  bool logSpaced() const { return _log_spaced; }
+
+private:
+  /// the first column of the data
+  std::vector<double> _energies;
+  /// the second column of the data
+  std::vector<double> _values;
+  /// the slope of each segment, segment i is between point i and i + 1
+  std::vector<double> _slopes;
+  /// the index of the first point which is not less than the lower edge of each bucket
+  std::vector<std::size_t> _bucket_start;
+  /// the slopes used to extend the table past its lower and upper ends
+  ///@{
+  double _lower_slope;
+  double _upper_slope;
+  ///@}
+  /// the exponents of the power laws that extend the table past its lower and upper ends
+  ///@{
+  double _lower_exponent;
+  double _upper_exponent;
+  ///@}
+  /// whether or not the buckets are spaced uniformly in log(x)
+  bool _log_spaced;
+  /// the lower edge of the first bucket (in log space when log spaced)
+  double _bucket_min;
+  /// the number of buckets per unit of x (or log(x))
+  double _bucket_scale;
+
+  /** Computes which bucket x is in, clamped to the valid buckets */
+  std::size_t bucket(const double x) const
+  {
+    const double b = ((_log_spaced ? std::log(x) : x) - _bucket_min) * _bucket_scale;
+    // written so that NaN also ends up in the first bucket
+    if (!(b > 0))
+      return 0;
+    const std::size_t last = _bucket_start.size() - 1;
+    return b >= static_cast<double>(last) ? last : static_cast<std::size_t>(b);
+  }
+};
+}
@@ -0,0 +1,84 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ArrayView.h"
+
+namespace prism
+{
+class MassActionKernel;
+
+/**
+ * Groups the columns of a sparse Jacobian so that no two columns in a group share a row
+ * (a distance-2 coloring of the rows and columns of the matrix)
+ * Every column in a group can be perturbed at the same time, so a finite difference Jacobian
+ * only costs one source evaluation per group instead of one per species.
+ * Columns are colored greedily from the most to the fewest entries, which gives
+ * the same coloring every time for the same pattern
+ */
+class JacobianColoring
+{
+public:
+  /**
+   * @param num_cols the number of columns in the Jacobian
+   * @param row_offsets where the entries of each row begin, with one entry more than the rows
+   * @param columns the column of every entry in the Jacobian
+   * @throws invalid_argument if the pattern is not valid
+   */
+  JacobianColoring(const std::size_t num_cols,
+                   const std::vector<std::size_t> & row_offsets,
+                   const std::vector<unsigned int> & columns);
+  /**
+   * Colors the Jacobian pattern of a mass action kernel
+   * @param kernel the kernel whose Jacobian pattern is colored
+   */
+  JacobianColoring(const MassActionKernel & kernel);
+
+  /** The number of groups of columns */
+  std::size_t numColors() const { return _group_offsets.size() - 1; }
+  /** The group that each column belongs to */
+  const std::vector<unsigned int> & colors() const { return _colors; }
+  /** Where the columns of each group begin in groupColumns(), with numColors() + 1 entries */
+  const std::vector<std::size_t> & groupOffsets() const { return _group_offsets; }
+  /** The columns of every group, sorted within each group */
+  const std::vector<unsigned int> & groupColumns() const { return _group_columns; }
+
+  /**
+   * Recovers the entries of the Jacobian from the compressed finite differences
+   * @param differences the change in every row when each group is perturbed divided by the
+   * perturbation, the difference for row i and group c is at c * rows + i
+   * @param values where the entries of the Jacobian are stored in the order of the pattern
+   * @throws invalid_argument if any of the views are the wrong size
+   */
+  void uncompress(const ArrayView<const double> differences, const ArrayView<double> values) const;
+
+private:
+  /// the number of columns in the Jacobian
+  std::size_t _num_cols;
+  /// the pattern of the Jacobian that was colored
+  ///@{
+  std::vector<std::size_t> _row_offsets;
+  std::vector<unsigned int> _columns;
+  ///@}
+  /// the group of every column
+  std::vector<unsigned int> _colors;
+  /// where the columns of each group begin
+  std::vector<std::size_t> _group_offsets;
+  /// the columns of every group
+  std::vector<unsigned int> _group_columns;
+
+  /** Colors the columns of the pattern */
+  void color();
+};
+}
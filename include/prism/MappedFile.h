@@ -0,0 +1,55 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace prism
+{
+/**
+ * Read only view of the contents of a file which is mapped into memory
+ * The file is never copied into a buffer, the pages are faulted in by the
+ * operating system as they are read
+ * The mapping is released when the object is destroyed
+ */
+class MappedFile
+{
+public:
+  /**
+   * Maps the entire file into memory
+   * isOpen() should be checked before the contents are used since the caller
+   * is expected to provide the error message that makes sense in their context
+   * @param file the file to map
+   */
+  MappedFile(const std::string & file);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  /** Whether or not the file could be opened */
+  bool isOpen() const { return _open; }
+  /** The entire contents of the file, this is empty for empty files */
+  std::string_view contents() const { return std::string_view(_data, _size); }
+  /** Self descriptive getter method */
+  std::size_t size() const { return _size; }
+
+private:
+  /// the start of the mapping, nullptr for empty files
+  const char * _data;
+  /// the size of the file in bytes
+  std::size_t _size;
+  /// whether or not the file could be opened
+  bool _open;
+};
+}
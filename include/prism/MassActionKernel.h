@@ -0,0 +1,169 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ArrayView.h"
+#include "StoichiometricMatrix.h"
+
+namespace prism
+{
+/**
+ * Assembles the mass action source terms dn/dt for every species in a block of reactions
+ * The rate of progress of reaction r is k_r times the product of its reactant densities
+ * raised to their number of occurances, and dn_s/dt is the sum over reactions of the net
+ * stoichiometric coefficient of s times the rate of progress.
+ * The reactants and the net coefficients are stored as flat arrays taken from the
+ * stoichiometric matrices of the block, typically NetworkParser::rateBasedStoichiometry().
+ * Each species sums the contributions of its reactions in reaction id order so the results
+ * are identical no matter how many threads are used.
+ * The analytic Jacobian d(dn/dt)/dn is assembled into a CSR pattern that is built once
+ * with the kernel, so solvers can allocate their matrix and preconditioner up front.
+ * The pattern always holds the diagonal, even for species that no reaction consumes.
+ * Densities are indexed by species id and rates by reaction id
+ */
+class MassActionKernel
+{
+public:
+  /**
+   * @param stoichiometry the stoichiometric matrices of the reactions the kernel evaluates
+   */
+  MassActionKernel(const StoichiometricMatrices & stoichiometry);
+
+  /**
+   * Computes the rate of progress of every reaction
+   * @param densities the density of every species
+   * @param rates the rate coefficient of every reaction
+   * @param progress where the rate of progress of every reaction is stored
+   * @param num_threads the maximum number of threads to use, 0 uses the number of hardware threads
+   * @throws invalid_argument if any of the views are the wrong size
+   */
+  void rateOfProgress(const ArrayView<const double> densities,
+                      const ArrayView<const double> rates,
+                      const ArrayView<double> progress,
+                      const unsigned int num_threads = 1) const;
+  /**
+   * Computes the source term dn/dt for every species
+   * @param densities the density of every species
+   * @param rates the rate coefficient of every reaction
+   * @param dndt where the source term of every species is stored
+   * @param num_threads the maximum number of threads to use, 0 uses the number of hardware threads
+   * @throws invalid_argument if any of the views are the wrong size
+   */
+  void sourceTerms(const ArrayView<const double> densities,
+                   const ArrayView<const double> rates,
+                   const ArrayView<double> dndt,
+                   const unsigned int num_threads = 1) const;
+  /**
+   * Computes the source terms for many cells at once, cells are split between threads
+   * The data for cell c starts at c * numSpecies() in the densities and source terms
+   * and at c * numReactions() in the rates
+   * @param num_cells the number of cells
+   * @param densities the density of every species in every cell
+   * @param rates the rate coefficient of every reaction in every cell
+   * @param dndt where the source term of every species in every cell is stored
+   * @param num_threads the maximum number of threads to use, 0 uses the number of hardware threads
+   * @throws invalid_argument if any of the views are the wrong size
+   */
+  void sourceTermsBatch(const std::size_t num_cells,
+                        const ArrayView<const double> densities,
+                        const ArrayView<const double> rates,
+                        const ArrayView<double> dndt,
+                        const unsigned int num_threads = 0) const;
+
+  /**
+   * Computes the Jacobian of the source terms with respect to the densities
+   * entry (s, j) is d(dn_s/dt)/dn_j and only entries in the pattern given by
+   * jacobianRowOffsets() and jacobianColumns() are computed
+   * @param densities the density of every species
+   * @param rates the rate coefficient of every reaction
+   * @param values where the entries of the Jacobian are stored in the order of
+   * jacobianColumns(), must be contiguous
+   * @throws invalid_argument if any of the views are the wrong size
+   */
+  void jacobian(const ArrayView<const double> densities,
+                const ArrayView<const double> rates,
+                const ArrayView<double> values) const;
+  /**
+   * Computes the Jacobian for many cells at once, cells are split between threads
+   * The entries for cell c start at c * jacobianNonZeros() in the values
+   * @param num_cells the number of cells
+   * @param densities the density of every species in every cell
+   * @param rates the rate coefficient of every reaction in every cell
+   * @param values where the entries of the Jacobian of every cell are stored, must be contiguous
+   * @param num_threads the maximum number of threads to use, 0 uses the number of hardware threads
+   * @throws invalid_argument if any of the views are the wrong size
+   */
+  void jacobianBatch(const std::size_t num_cells,
+                     const ArrayView<const double> densities,
+                     const ArrayView<const double> rates,
+                     const ArrayView<double> values,
+                     const unsigned int num_threads = 0) const;
+  /** Where the entries of each row of the Jacobian begin, with numSpecies() + 1 entries */
+  const std::vector<std::size_t> & jacobianRowOffsets() const { return _jacobian_offsets; }
+  /** The column of every entry in the Jacobian, sorted within each row */
+  const std::vector<unsigned int> & jacobianColumns() const { return _jacobian_columns; }
+  /** The number of entries in the Jacobian pattern */
+  std::size_t jacobianNonZeros() const { return _jacobian_columns.size(); }
+
+  /** Self descriptive getter method */
+  std::size_t numSpecies() const { return _num_species; }
+  /** Self descriptive getter method */
+  std::size_t numReactions() const { return _num_rxns; }
+
+private:
+  /// the number of species the kernel was built for
+  std::size_t _num_species;
+  /// the number of reactions the kernel was built for
+  std::size_t _num_rxns;
+  /// where the reactants of each reaction begin in _reactants and _orders
+  std::vector<std::size_t> _reactant_offsets;
+  /// the species id of every reactant of every reaction
+  std::vector<unsigned int> _reactants;
+  /// the number of times each reactant occurs in its reaction
+  std::vector<unsigned int> _orders;
+  /// where the reactions of each species begin in _rxns and _coeffs
+  std::vector<std::size_t> _species_offsets;
+  /// the id of every reaction that changes the amount of each species
+  std::vector<unsigned int> _rxns;
+  /// the net stoichiometric coefficient of each species in each of its reactions
+  std::vector<double> _coeffs;
+  /// the sparsity pattern of the Jacobian in CSR form
+  ///@{
+  std::vector<std::size_t> _jacobian_offsets;
+  std::vector<unsigned int> _jacobian_columns;
+  ///@}
+  /// where the Jacobian terms for each reactant of each reaction begin in
+  /// _term_positions and _term_coeffs
+  std::vector<std::size_t> _term_offsets;
+  /// the position in the Jacobian values each term is added to
+  std::vector<std::size_t> _term_positions;
+  /// the net stoichiometric coefficient each term is multiplied by
+  std::vector<double> _term_coeffs;
+
+  /** Computes the rate of progress of a single reaction */
+  double reactionProgress(const std::size_t rxn,
+                          const ArrayView<const double> & densities,
+                          const ArrayView<const double> & rates) const;
+  /** Sums the contributions of every reaction to a single species */
+  double gather(const std::size_t species, const ArrayView<double> & progress) const;
+  /** Computes every entry of the Jacobian for a single cell */
+  void computeJacobian(const ArrayView<const double> & densities,
+                       const ArrayView<const double> & rates,
+                       double * values) const;
+  /** Throws if a view with size entries is smaller than required */
+  static void
+  checkSize(const std::size_t size, const std::size_t required, const std::string & name);
+};
+}
@@ -0,0 +1,44 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <vector>
+
+#include "InterpolationTable.h"
+
+namespace prism
+{
+/**
+ * Computes the rate coefficient of a cross section for electrons with a Maxwellian
+ * energy distribution
+ *
+ * k(T_e) = sqrt(2 e / m_e) (2 / sqrt(pi)) T_e^(-3/2) int sigma(eps) eps exp(-eps / T_e) d eps
+ *
+ * The cross section is linear between the points in the table and zero outside of it.
+ * Each segment of the table is integrated with Gauss-Legendre quadrature on pieces no
+ * wider than T_e, and the integration stops once the Maxwellian has decayed to nothing
+ * @param xsec the cross section in m^2 as a function of energy in eV
+ * @param T_e the electron temperature in eV
+ * @returns the rate coefficient in m^3 / s
+ */
+double maxwellianRateCoefficient(const InterpolationTable & xsec, const double T_e);
+
+/**
+ * Creates the electron temperatures for a rate coefficient table
+ * points are spaced evenly in log(T_e)
+ * @param min_T_e the smallest temperature in eV
+ * @param max_T_e the largest temperature in eV
+ * @param num_points the number of temperatures
+ */
+std::vector<double> rateCoefficientTemperatures(const double min_T_e,
+                                                const double max_T_e,
+                                                const unsigned int num_points);
+}
@@ -11,7 +11,14 @@
 #pragma once
 
 #include "PrismConstants.h"
+#include "StoichiometricMatrix.h"
+#include "CompositionMatrix.h"
+#include "CanonicalReactionKey.h"
+#include "SpeciesOrdering.h"
+#include "FileStamp.h"
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -25,17 +32,29 @@ class SpeciesFactory;
 class BibTexHelper;
 class TableWriterBase;
 class SpeciesSummaryWriterBase;
+class UnifiedEnergyGrid;
+class CompiledNetwork;
+enum class ExtrapolationPolicy;
 
 /**
  * This is the class that processes reaction networks and
  * allows for interaction with the data contained in the network
+ * Every parser created with its constructor owns its own species and references so
+ * separate parsers can hold different networks and parse them on different threads.
+ * instance() provides a shared default parser for codes that only need a single network
  */
 class NetworkParser
 {
 public:
-  /** Getter for the singleton instance */
+  /** Creates a parser which is independent of every other parser */
+  NetworkParser();
+  ~NetworkParser();
+  /** Getter for the shared default instance */
   static NetworkParser & instance();
-  /** Resets the parser to a fresh state, as if no networks have been processed */
+  /**
+   * Resets the parser to a fresh state, as if no networks have been processed
+   * the species ordering and whether references are checked lazily are kept
+   */
   void clear();
   /**
    * Method goes through all of the reactions in this network
@@ -44,6 +63,64 @@ public:
    * @param file the yaml file which contains the reaction network
    */
   void parseNetwork(const std::string & file);
+  /**
+   * Parses a network again after its files have been modified
+   * only the reactions whose inputs or data files have changed are constructed again and the
+   * species are only re-indexed when the set of species in the networks changes, so species
+   * keep their ids while reactions are being edited
+   * Changes are found with the modification times and hashes of the files.
+   * Changes to anything other than the reaction blocks, or to the bib file, cause every network
+   * to be parsed again from scratch, as do networks that were loaded from a cache
+   * @param file a yaml file which contains a reaction network, it is parsed with
+   * parseNetwork(file) if it has not been parsed before
+   */
+  void reparseNetwork(const std::string & file);
+  /**
+   * Loads the network from a cache written by writeCache() if the cache is still valid,
+   * otherwise the network is parsed with parseNetwork(file) and a new cache is written
+   * A cache is only valid when it holds this network alone, it was written with the same
+   * parser settings, and none of the network, bib, or data files have changed since.
+   * Loading a network skips all of the validation done while parsing
+   * @param file the yaml file which contains the reaction network
+   * @param cache_file the binary file the network is cached in
+   */
+  void parseNetwork(const std::string & file, const std::string & cache_file);
+  /**
+   * Writes every network that has been parsed to a versioned and checksummed binary file
+   * the hashes of the network, bib, and data files are stored with the network so
+   * changes to them can be detected when the cache is loaded
+   * This function will exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   * @param cache_file the file the cache is written to
+   * @throws invalid_argument if the cache cannot be written or a source file cannot be read
+   */
+  void writeCache(const std::string & cache_file) const;
+  /**
+   * Selects how species ids are assigned, the ordering is applied to every
+   * network parsed after this call
+   * transient species always have lower ids than constant species
+   * @param ordering the strategy used to assign species ids
+   * @param user_ordering the species names in the order they should be given ids,
+   * only used with SpeciesOrdering::USER. Species that are not listed are given
+   * ids after all of the listed species
+   */
+  void setSpeciesOrdering(const SpeciesOrdering ordering,
+                          const std::vector<std::string> & user_ordering = {});
+  /**
+   * Sets the number of threads used to construct reactions and build rate coefficient tables
+   * the parsed network is the same no matter how many threads are used
+   * @param num_threads the maximum number of threads, 0 uses the number of hardware threads
+   */
+  void setNumThreads(const unsigned int num_threads) { _num_threads = num_threads; }
+  /**
+   * Sets whether bib files are scanned for every citekey up front or only searched for the
+   * citekeys that reactions reference, the first time each one is referenced
+   * lazy checks are faster for large shared bibliographies that a network only cites a few
+   * entries from, but malformed entries and repeated citekeys are only reported for the
+   * citekeys that are referenced
+   * @param lazy whether or not to check the references lazily
+   */
+  void setLazyReferenceChecks(const bool lazy) { _lazy_references = lazy; }
 
 // These methods are only available in testing mode
 // this allows for easier unit testing and should never
@@ -129,6 +206,65 @@ public:
     preventInvalidDataFetch();
     return _function_rate_based;
   }
+  /**
+   * Gets the data from all of the reactions in tabulatedXSecReactions()
+   * merged onto a single energy grid, so that every reaction can be sampled with one search.
+   * The grid is only built the first time it is requested after a network is parsed,
+   * it is safe to request it from several threads at once.
+   * Grids that are held on to stay valid after more networks are parsed or the parser
+   * is cleared.
+   * This function will exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   * @returns the grid containing every tabulated cross section reaction
+   */
+  std::shared_ptr<const UnifiedEnergyGrid> unifiedXSecGrid() const;
+  /**
+   * Gets a snapshot of all of the species and reactions in the network stored in flat arrays
+   * this is the preferred way to access the network from inside of a solver
+   * The snapshot is only built the first time it is requested after a network is parsed,
+   * it is safe to request it from several threads at once.
+   * Snapshots that are held on to stay valid after more networks are parsed or the parser
+   * is cleared, they just no longer describe the parser.
+   * This function will exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   */
+  std::shared_ptr<const CompiledNetwork> compiledNetwork() const;
+  /**
+   * Gets the net, reactant, and product stoichiometric matrices of the rate-based block
+   * rows are reaction ids in the rate-based block and columns are species ids.
+   * The matrices are rebuilt every time a network is parsed.
+   * This function will exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   */
+  const StoichiometricMatrices & rateBasedStoichiometry() const
+  {
+    preventInvalidDataFetch();
+    return _rate_stoichiometry;
+  }
+  /**
+   * Gets the net, reactant, and product stoichiometric matrices of the xsec-based block
+   * rows are reaction ids in the xsec-based block and columns are species ids.
+   * The matrices are rebuilt every time a network is parsed.
+   * This function will exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   */
+  const StoichiometricMatrices & xsecBasedStoichiometry() const
+  {
+    preventInvalidDataFetch();
+    return _xsec_stoichiometry;
+  }
+  /**
+   * Gets the number of each element in every species along with their charge numbers
+   * rows are species ids, this lets solvers check elemental and charge conservation cheaply.
+   * The matrix is rebuilt every time a network is parsed.
+   * This function will exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   */
+  const CompositionMatrix & compositionMatrix() const
+  {
+    preventInvalidDataFetch();
+    return _composition;
+  }
   /**
    * Gets all of the species in the network that have a non-zero
    * This function will also exist the program if there are any errors in the
@@ -145,6 +281,39 @@ public:
    * @returns a vector of shared_ptr for all unique species in the network
    */
   const std::vector<std::string> & speciesNames() const;
+  /**
+   * Gets the id of a species from its name in constant time
+   * this is the lookup coupling codes should use to find the species they track
+   * This function will also exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   * @param name the name of the species, species lumped into another state are not in the network
+   * @throws invalid_argument if there is no species with this name in the network
+   */
+  SpeciesId speciesId(const std::string & name) const;
+  /**
+   * Finds the rate-based reaction which describes the same process as an expression,
+   * the order the species are written in does not matter and lumped species are replaced
+   * with the state they are lumped into. When the network contains duplicates of the
+   * process the one with the lowest id is provided
+   * This function will also exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   * @param expression the reaction, Ex: "e + Ar -> 2e + Ar+"
+   * @throws invalid_argument if the expression is not a valid reaction
+   * @returns the reaction or nullptr if there is no reaction for the process
+   */
+  std::shared_ptr<const Reaction> findRateBasedReaction(const std::string & expression) const;
+  /**
+   * Finds the xsec-based reaction which describes the same process as an expression,
+   * the order the species are written in does not matter and lumped species are replaced
+   * with the state they are lumped into. When the network contains duplicates of the
+   * process the one with the lowest id is provided
+   * This function will also exist the program if there are any errors in the
+   * reaction networks that have been parsed
+   * @param expression the reaction, Ex: "e + Ar -> 2e + Ar+"
+   * @throws invalid_argument if the expression is not a valid reaction
+   * @returns the reaction or nullptr if there is no reaction for the process
+   */
+  std::shared_ptr<const Reaction> findXSecBasedReaction(const std::string & expression) const;
 
   /**
    * Gets all of the species in the network
@@ -182,17 +351,24 @@ public:
   void writeSpeciesSummary(const std::string & file, SpeciesSummaryWriterBase & writer) const;
 
 private:
-  /** private constructor because only this class can create itself */
-  NetworkParser();
-  /** delete the copy constructor to make this a singleton */
+  /**
+   * Creates a parser which uses an existing factory and bib helper
+   * this is only used to create the shared default instance
+   */
+  NetworkParser(SpeciesFactory & factory, BibTexHelper & bib_helper);
+  /** parsers cannot be copied since they own their species */
   NetworkParser(const NetworkParser &) = delete;
-  /** delete the copy assignment to make this a singleton */
+  /** parsers cannot be copied since they own their species */
   NetworkParser & operator=(const NetworkParser &) = delete;
+  /// the factory and bib helper owned by this parser, empty for the default instance
+  ///@{
+  std::unique_ptr<SpeciesFactory> _owned_factory;
+  std::unique_ptr<BibTexHelper> _owned_bib_helper;
+  ///@}
+  /// the factory which holds the species of this parser
   SpeciesFactory & _factory;
+  /// the helper which holds the cite keys of this parser
   BibTexHelper & _bib_helper;
-  /// Private instance of the singleton,
-  /// this is the only instance of this class that will ever exist
-  static NetworkParser * _instance;
   /// wether or not the parser encountered any errors during parsing
   bool _network_has_errors;
   /// wether or not the parser encountered any issues with the bib files while parsing
@@ -200,6 +376,8 @@ private:
   /// wether or not to check for valid references for reactions,
   /// this is only false in testing mode
   bool _check_refs;
+  /// whether or not bib files are only searched for the citekeys that reactions reference
+  bool _lazy_references;
   /// wehter or not to actually read data from files
   /// this is only false in testing mode
   bool _read_xsec_files;
@@ -211,8 +389,48 @@ private:
   std::unordered_map<std::string, std::string> _data_paths;
   /// map for keeping track of the delimiters used for data in each mechanism file
   std::unordered_map<std::string, std::string> _delimiters;
+  /// map for keeping track of the default extrapolation policy of each mechanism file
+  std::unordered_map<std::string, ExtrapolationPolicy> _extrapolation_policies;
+  /// map for keeping track of which mechanism files count extrapolations
+  std::unordered_map<std::string, bool> _count_extrapolations;
   ReactionId _rate_id;
   ReactionId _xsec_id;
+  /// the maximum number of threads used to construct reactions
+  unsigned int _num_threads;
+  /// every file that the parsed networks were built from, in the order they were read
+  std::vector<std::string> _source_files;
+  /**
+   * What each reaction in a block of a network was built from
+   * every vector has one entry for each reaction input in the block, in input order
+   */
+  struct ReactionSources
+  {
+    /// the yaml input of each reaction as text
+    std::vector<std::string> inputs;
+    /// the data file of each reaction, empty when no file was read
+    std::vector<std::string> data_files;
+    /// the state of each data file when it was read
+    std::vector<FileStamp> data_stamps;
+    /// the reaction built from each input, empty when the input had errors
+    std::vector<std::shared_ptr<Reaction>> reactions;
+  };
+  /** What a network was built from, used to find the parts reparseNetwork() needs to rebuild */
+  struct NetworkSources
+  {
+    /// the state of the network file when it was parsed
+    FileStamp stamp;
+    /// the state of the bib file when its references were collected
+    FileStamp bib_stamp;
+    /// every block other than the reaction blocks as yaml text
+    std::string settings;
+    /// the sources of the reactions in the rate and xsec based blocks
+    ///@{
+    ReactionSources rate;
+    ReactionSources xsec;
+    ///@}
+  };
+  /// the sources of every network which has been parsed, networks loaded from a cache have none
+  std::unordered_map<std::string, NetworkSources> _network_sources;
   /**
    * checks to make sure a network input file exists
    * also checks to make sure it hasn't already been parsed
@@ -231,6 +449,7 @@ private:
 
   /**
    * Function parses the reactions from a given network
+   * the reactions are constructed in parallel and then added to the lists in input order
    * @param inputs the yaml nodes which contain all of the reactions to be parsed
    * @param rxn_list the list of reactions that any new reaction will be added to
    * @param tabulated_rxn_list the list reactions which have data in files that any
@@ -240,8 +459,15 @@ private:
    * @param type the type of reaction currently being parsed (cross section vs rate)
    * @param data_path the location where the files that store tabulated data exist
    * @param bib_file the bib file which contains the cite keys needed for these reactions
+   * @param delimiter the delimiter used in the files that store tabulated data
+   * @param extrapolation the extrapolation policy for reactions that do not provide their own
+   * @param count_extrapolations whether or not the reactions count their extrapolations
+   * @param previous the sources of the block the last time it was parsed, reactions whose
+   * sources are unchanged and that keep their ids are reused instead of constructed again
+   * @param sources where the sources of the reactions in the block are stored
+   * @returns the number of reactions which were constructed
    */
-  void parseReactions(const YAML::Node & inputs,
+  std::size_t parseReactions(const YAML::Node & inputs,
                       ReactionId * rxn_id,
                       std::vector<std::shared_ptr<Reaction>> * rxn_list,
                       std::vector<std::shared_ptr<const Reaction>> * tabulated_rxn_list,
@@ -249,7 +475,112 @@ private:
                       const std::string & type,
                       const std::string & data_path,
                       const std::string & bib_file,
-                      const std::string & _delimiter);
+                      const std::string & delimiter,
+                      const ExtrapolationPolicy extrapolation,
+                      const bool count_extrapolations,
+                      const ReactionSources * previous,
+                      ReactionSources & sources);
+  /**
+   * Indexes the species after reactions have been parsed and rebuilds everything
+   * that depends on the species ids
+   * @param reindex whether or not the species ids are assigned with the species ordering,
+   * otherwise the species keep their current order
+   * @param new_rate_rxns the range of rate based reactions added by the current parse
+   * @param new_xsec_rxns the range of cross section based reactions added by the current parse
+   */
+  void finalizeNetworks(const bool reindex,
+                        const std::pair<std::size_t, std::size_t> & new_rate_rxns,
+                        const std::pair<std::size_t, std::size_t> & new_xsec_rxns);
+  /** The networks which have been parsed, in the order they were parsed */
+  std::vector<std::string> networkFiles() const;
+  /**
+   * Parses every network again from scratch with the same settings
+   * this is used when a change cannot be applied by reparseNetwork() incrementally
+   */
+  void reparseAll();
+
+  /**
+   * Reads the temperatures that the Maxwellian rate coefficient tables are built on
+   * @param network the network which is currently being parsed
+   * @returns the temperatures, empty when the network did not request rate coefficient tables
+   * Function will exit the program if the block is invalid
+   */
+  std::vector<double> collectRateCoefficientTemperatures(const YAML::Node & network) const;
+  /**
+   * Builds the Maxwellian rate coefficient tables for the tabulated xsec-based reactions
+   * the integrals for every reaction and temperature are split between threads
+   * reactions which already have a table keep it
+   * @param temperatures the electron temperatures of the tables
+   * @param first_rxn the index of the first reaction in the xsec-based list to build a table for
+   */
+  void buildRateCoefficientTables(const std::vector<double> & temperatures,
+                                  const std::size_t first_rxn);
+
+  /**
+   * Restores the network from a cache written by writeCache()
+   * the parser is only modified when the entire cache is valid
+   * @param file the yaml file which contains the reaction network
+   * @param cache_file the binary file the network is cached in
+   * @returns false if the cache does not exist, is corrupt, or is out of date
+   */
+  bool loadCache(const std::string & file, const std::string & cache_file);
+  /**
+   * The parser settings that change the parsed network in their binary form
+   * a cache can only be used by a parser with the same settings
+   */
+  std::string cacheSettings() const;
+
+  /**
+   * Builds the stoichiometric matrices for a list of reactions
+   * this must be called after the species have been indexed
+   * @param rxn_list the reactions to build the matrices for
+   * @param num_rxns the number of reaction ids which have been given out in the block
+   */
+  StoichiometricMatrices
+  buildStoichiometricMatrices(const std::vector<std::shared_ptr<Reaction>> & rxn_list,
+                              const ReactionId num_rxns) const;
+
+  /**
+   * Indexes every reaction in a block by the process it describes and warns about
+   * reactions that were written the same as a reaction before them, either with
+   * the same data (a duplicate) or with different data (a conflict)
+   * reactions are compared before lumping so lumped channels are not reported
+   * this must be called after the species data of the reactions has been set
+   * @param rxn_list the reactions in the block
+   * @param processes the index of the first reaction of every process in the block
+   * @param new_rxns the range of reactions in the block which are reported
+   */
+  void indexProcesses(
+      const std::vector<std::shared_ptr<Reaction>> & rxn_list,
+      std::unordered_map<CanonicalReactionKey, std::shared_ptr<const Reaction>> & processes,
+      const std::pair<std::size_t, std::size_t> & new_rxns);
+  /**
+   * Builds the canonical key of a reaction expression
+   * @param expression the reaction expression
+   * @param key the key of the expression
+   * @param lump whether the key is built from the species in the network after lumping,
+   * otherwise the key is built from the symbols of the species as they are written
+   * @throws invalid_argument if the expression is not a valid reaction
+   * @returns false if any of the species are not in the network
+   */
+  bool canonicalKey(const std::string & expression,
+                    CanonicalReactionKey & key,
+                    const bool lump = true) const;
+  /** Helper for the find reaction methods */
+  std::shared_ptr<const Reaction> findReaction(
+      const std::string & expression,
+      const std::unordered_map<CanonicalReactionKey, std::shared_ptr<const Reaction>> & processes)
+      const;
+  /**
+   * Builds the composition matrix of every species in the network
+   * this must be called after the species have been indexed
+   */
+  CompositionMatrix buildCompositionMatrix() const;
+  /**
+   * Writes every section of the reaction table document, flushing the writer
+   * after each table so that the writer only ever holds a single table
+   */
+  void writeTableDocument(TableWriterBase & writer) const;
 
   void tableHelper(TableWriterBase & writer,
                    void (TableWriterBase::*beginTable)(),
@@ -274,5 +605,23 @@ private:
   std::vector<std::shared_ptr<const Reaction>> _tabulated_xsec_based;
   std::vector<std::shared_ptr<const Reaction>> _function_xsec_based;
   ///@}
+  /// the tabulated cross section data on a single grid, only built when requested
+  mutable std::shared_ptr<const UnifiedEnergyGrid> _xsec_grid;
+  /// the flat copy of the network, only built when requested
+  mutable std::shared_ptr<const CompiledNetwork> _compiled;
+  /// guards the data that is only built when it is first requested
+  mutable std::mutex _lazy_mutex;
+  /// the stoichiometric matrices for each block of reactions
+  ///@{
+  StoichiometricMatrices _rate_stoichiometry;
+  StoichiometricMatrices _xsec_stoichiometry;
+  ///@}
+  /// the elemental composition of every species
+  CompositionMatrix _composition;
+  /// the first reaction of every process in each block
+  ///@{
+  std::unordered_map<CanonicalReactionKey, std::shared_ptr<const Reaction>> _rate_processes;
+  std::unordered_map<CanonicalReactionKey, std::shared_ptr<const Reaction>> _xsec_processes;
+  ///@}
 };
 }
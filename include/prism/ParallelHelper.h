@@ -0,0 +1,62 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace prism
+{
+/**
+ * Calls f(i) for every i in [0, n) spread across a number of threads
+ * Work is handed out in small chunks so threads that finish early keep working
+ * f must be safe to call concurrently for different values of i
+ * @param n the number of iterations
+ * @param f the work for a single iteration
+ * @param num_threads the maximum number of threads to use, 0 uses the number of hardware threads
+ */
+template <typename Function>
+void
+parallelFor(const std::size_t n, const Function & f, unsigned int num_threads = 0)
+{
+  if (num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+  const std::size_t chunk = 16;
+  const std::size_t num_chunks = (n + chunk - 1) / chunk;
+  num_threads = static_cast<unsigned int>(std::min<std::size_t>(num_threads, num_chunks));
+
+  std::atomic<std::size_t> next_chunk(0);
+  auto work = [&]()
+  {
+    for (std::size_t c = next_chunk++; c < num_chunks; c = next_chunk++)
+      for (std::size_t i = c * chunk; i < std::min(n, (c + 1) * chunk); ++i)
+        f(i);
+  };
+
+  if (num_threads <= 1)
+  {
+    work();
+    return;
+  }
+
+  // the calling thread does its share of the work as well
+  std::vector<std::thread> threads;
+  for (unsigned int t = 1; t < num_threads; ++t)
+    threads.emplace_back(work);
+  work();
+  for (auto & t : threads)
+    t.join();
+}
+}
@@ -9,6 +9,7 @@
 //* ALL RIGHTS RESERVED
 //*
 #pragma once
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -25,6 +26,10 @@ const std::string CUSTOM_SPECIES = "custom-species";
 const std::string LUMPED_SPECIES = "lumped-species";
 const std::string CONSTANT_SPECIES = "constant-species";
 const std::string DATA_DELIMITER = "data-delimiter";
+const std::string MAXWELLIAN_RATES = "maxwellian-rates";
+/// extrapolation can also be provided in a reaction to override the network value
+const std::string EXTRAPOLATION_KEY = "extrapolation";
+const std::string COUNT_EXTRAPOLATIONS_KEY = "count-extrapolations";
 ///@}
 /// vector of allowed upper level input blocks for param checking
 const std::vector<std::string> allowed_network_inputs = {BIB_KEY,
@@ -35,12 +40,23 @@ const std::vector<std::string> allowed_network_inputs = {BIB_KEY,
                                                          CUSTOM_SPECIES,
                                                          LUMPED_SPECIES,
                                                          CONSTANT_SPECIES,
-                                                         DATA_DELIMITER};
+                                                         DATA_DELIMITER,
+                                                         MAXWELLIAN_RATES,
+                                                         EXTRAPOLATION_KEY,
+                                                         COUNT_EXTRAPOLATIONS_KEY};
 /// input keys for the custom species block
 const std::string NAME_KEY = "name";
 const std::string MASS_KEY = "mass";
 /// vector of allowed inputs blocks in the custom species block
 const std::vector<std::string> allowed_custom_params = {NAME_KEY, MASS_KEY};
+/// input keys for the maxwellian rates block
+const std::string MIN_TEMPERATURE_KEY = "min-temperature";
+const std::string MAX_TEMPERATURE_KEY = "max-temperature";
+const std::string POINTS_KEY = "points";
+const unsigned int DEFAULT_RATE_POINTS = 200;
+const std::vector<std::string> allowed_maxwellian_params = {MIN_TEMPERATURE_KEY,
+                                                            MAX_TEMPERATURE_KEY,
+                                                            POINTS_KEY};
 /// input keys for lumping block
 const std::string LUMPED_KEY = "lumped";
 const std::string ACTUAL_KEY = "actual";
@@ -66,7 +82,8 @@ const std::vector<std::string> allowed_reaction_params = {REACTION_KEY,
                                                           NOTE_KEY,
                                                           REFERENCE_KEY,
                                                           FILE_KEY,
-                                                          PARAM_KEY};
+                                                          PARAM_KEY,
+                                                          EXTRAPOLATION_KEY};
 
 const bool REQUIRED = true;
 const bool OPTIONAL = false;
@@ -78,6 +95,11 @@ const double ROOM_TEMP_EV = 0.025;
 const double N_A = 6.02214179E+23;
 /// elemental charge in C
 const double ELEMENTAL_CHARGE = 1.602176487E-19;
+/// electron mass in kg
+const double ELECTRON_MASS = 9.10938215E-31;
+/// size of the file buffer used when writing reaction tables and species summaries in bytes
+const std::size_t WRITER_BUFFER_SIZE = 1 << 20;
 typedef unsigned int ReactionId;
 typedef unsigned int SpeciesId;
+typedef unsigned int ElementId;
 }
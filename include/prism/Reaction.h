@@ -12,14 +12,23 @@
 
 #include <utility>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include "yaml-cpp/yaml.h"
 #include "Species.h"
+#include "SymbolTable.h"
+#include "CanonicalReactionKey.h"
 #include "PrismConstants.h"
+#include "ArrayView.h"
+#include "InterpolationTable.h"
+#include <atomic>
 #include <functional>
 namespace prism
 {
+class SpeciesFactory;
+class BibTexHelper;
+
 /**
  * Struct for holding tabulated data
  * read from user provided files
@@ -53,6 +62,49 @@ struct TabulatedReactionData
   }
 };
 
+/**
+ * The functional forms that reactions with function parameters can take
+ * the form is selected by the number of parameters provided in the input file
+ */
+enum class FunctionalForm
+{
+  /// k = A
+  CONSTANT,
+  /// k = A (T_e / T_r)^n_e
+  PARTIAL_ARRHENIUS_1,
+  /// k = A (T_e / T_r)^n_e exp(-E_e / T_e)
+  PARTIAL_ARRHENIUS_2,
+  /// k = A (T_e / T_r)^n_e exp(-E_e / T_e) (T_g / T_r)^n_g
+  PARTIAL_ARRHENIUS_3,
+  /// k = A (T_e / T_r)^n_e exp(-E_e / T_e) (T_g / T_r)^n_g exp(-E_g / T_g)
+  FULL_ARRHENIUS
+};
+
+/**
+ * What happens when tabulated data is sampled outside of the range of the table
+ * the policy is selected when the network is parsed
+ */
+enum class ExtrapolationPolicy
+{
+  /// an invalid_argument exception is thrown
+  ERROR,
+  /// the value at the nearest end of the table is used
+  CLAMP,
+  /// zero is used
+  ZERO,
+  /// the segment at the nearest end of the table is extended, never going below zero
+  LINEAR,
+  /// a power law through the two points at the nearest end of the table is used
+  POWER_LAW
+};
+
+/**
+ * Converts the name used in the input file to an ExtrapolationPolicy
+ * @param name one of "error", "clamp", "zero", "linear", "power-law"
+ * @throws invalid_argument if the name is not one of the policies
+ */
+ExtrapolationPolicy extrapolationPolicyFromString(const std::string & name);
+
 /**
  * Struct for quickly accessing data about which speies
  * are in a reaction
@@ -82,6 +134,8 @@ public:
    * @param read_xsec_files whether or not this reaction will actually collect the data from the
    * provided file. This will will never be false in real use
    * @param delimiter the delimieter that seperates the columns in the data file
+   * @param extrapolation the extrapolation policy used when the reaction does not provide one
+   * @param count_extrapolations whether or not to count samples outside of the tabulated data
    * @throws InvalidReaction if the user has provided a file where to find data and parameters for
    * functional data
    * @throws InvalidReaction if the user does not provide a file and does not provide function
@@ -92,6 +146,8 @@ public:
    * @throws InvalidReaction if the user provides a data file and the first column has data that is
    * not in sorted order
    * @throws InvalidReaction if the user has extra unused parameters in an input block
+   * @throws InvalidReaction if the user provides an invalid extrapolation policy or provides one
+   * for a reaction without tabulated data
    */
   Reaction(const YAML::Node & rxn_input,
            const int rxn_id = 0,
@@ -99,7 +155,33 @@ public:
            const std::string & bib_file = "",
            const bool check_refs = true,
            const bool read_xsec_files = true,
-           const std::string & delimiter = " ");
+           const std::string & delimiter = " ",
+           const ExtrapolationPolicy extrapolation = ExtrapolationPolicy::ERROR,
+           const bool count_extrapolations = false);
+  /**
+   * Same as the constructor above but the species are created in and the references are
+   * checked against the provided objects instead of the shared instances,
+   * this is how each NetworkParser keeps its reactions separate from every other parser
+   * @param factory the factory which creates the species in the reaction
+   * @param bib_helper the helper which holds the cite keys of the bib file
+   */
+  Reaction(SpeciesFactory & factory,
+           BibTexHelper & bib_helper,
+           const YAML::Node & rxn_input,
+           const int rxn_id,
+           const std::string & data_path,
+           const std::string & bib_file,
+           const bool check_refs,
+           const bool read_xsec_files,
+           const std::string & delimiter,
+           const ExtrapolationPolicy extrapolation,
+           const bool count_extrapolations);
+  /**
+   * Copies a reaction, the copy samples its own data and keeps its own count of extrapolations
+   * starting from the count of the reaction it was copied from
+   * reactions cannot be assigned since most of their data is constant
+   */
+  Reaction(const Reaction & other);
 
   /**
    * Self descriptive getter method
@@ -164,12 +246,34 @@ public:
    * provided
    */
   const std::vector<double> & functionParams() const;
+  /**
+   * Returns the functional form that is used to sample the function parameters
+   * @throws invalid_argument if this method is called on a reaction for which tabulated data was
+   * provided
+   */
+  FunctionalForm functionalForm() const;
   /**
    * Retrurns a reference to the struct containing data read from a file
    * @throws invalid_argument if this method is called on a reaction that has a functional
    * parameters provided
    */
   const std::vector<TabulatedReactionData> & tabulatedData() const;
+  /**
+   * Returns a reference to the indexed table used to sample the data read from a file
+   * @throws invalid_argument if this method is called on a reaction that has a functional
+   * parameters provided
+   */
+  const InterpolationTable & interpolationTable() const;
+  /**
+   * Whether or not a Maxwellian rate coefficient table was built for this reaction
+   * tables are only built for xsec-based reactions when the network requests them
+   */
+  bool hasRateCoefficientTable() const { return !_rate_table.empty(); }
+  /**
+   * Returns a reference to the Maxwellian rate coefficient as a function of electron temperature
+   * @throws invalid_argument if no rate coefficient table was built for this reaction
+   */
+  const InterpolationTable & rateCoefficientTable() const;
   /**
    * Get the stoiciometric coefficient for a species in this reaction
    * by the name that represents it
@@ -194,6 +298,17 @@ public:
   bool operator==(const Reaction & other) const;
   /** returns not == operator overload */
   bool operator!=(const Reaction & other) const;
+  /**
+   * The key of the process this reaction describes, independent of the order the species
+   * were written in. This is only valid once the species have been indexed
+   */
+  CanonicalReactionKey canonicalKey() const;
+  /**
+   * Whether or not two reactions provide the same data, the function parameters
+   * or tabulated data along with the energy changes are compared
+   * @param other the reaction to compare against
+   */
+  bool hasSameData(const Reaction & other) const;
   /**
    * Samples data at the point T_e and T_g based on the provided parameters
    * If the reaction object has tabulated data then the second parameter is ignored
@@ -204,6 +319,73 @@ public:
    * @param T_g the gas temperature
    */
   double sampleData(const double T_e, const double T_g = 0) const { return _sampler(T_e, T_g); }
+  /**
+   * Samples the data the same way as sampleData(T_e, T_g) but tabulated data
+   * is searched starting from where the last sample with the cursor landed.
+   * This is much faster when the temperature only changes a little between calls, such as
+   * when each cell of a simulation keeps its own cursor between time steps
+   * @param T_e the electron temperature
+   * @param T_g the gas temperature
+   * @param cursor the caller owned search state, updated by this call
+   */
+  double sampleData(const double T_e, const double T_g, InterpolationCursor & cursor) const;
+  /**
+   * Samples the data with a cursor when the gas temperature is not needed
+   * @param T_e the electron temperature
+   * @param cursor the caller owned search state, updated by this call
+   */
+  double sampleData(const double T_e, InterpolationCursor & cursor) const
+  {
+    return sampleData(T_e, 0, cursor);
+  }
+  /** The policy used when tabulated data is sampled outside of the range of the table */
+  ExtrapolationPolicy extrapolationPolicy() const { return _extrapolation; }
+  /**
+   * The number of samples that were outside of the range of the tabulated data
+   * this is always zero unless the network asked for extrapolations to be counted
+   */
+  std::size_t extrapolationCount() const { return _extrapolation_count.load(); }
+  /** Sets the number of extrapolations back to zero */
+  void resetExtrapolationCount() { _extrapolation_count = 0; }
+  /**
+   * Samples the Maxwellian rate coefficient table built from the cross section data
+   * @param T_e the electron temperature
+   * @throws invalid_argument if no table was built
+   * @throws invalid_argument if T_e is outside of the table and the extrapolation policy is ERROR
+   */
+  double sampleRateCoefficient(const double T_e) const;
+  /**
+   * Samples the Maxwellian rate coefficient table starting the search from the cursor
+   * @param T_e the electron temperature
+   * @param cursor the caller owned search state, updated by this call
+   * @throws invalid_argument if no table was built
+   * @throws invalid_argument if T_e is outside of the table and the extrapolation policy is ERROR
+   */
+  double sampleRateCoefficient(const double T_e, InterpolationCursor & cursor) const;
+  /**
+   * Samples data at many points at once
+   * This is equivalent to calling sampleData(T_e[i], T_g[i]) for every point
+   * but avoids the per point dispatch cost, so it should be preferred when a reaction
+   * needs to be sampled at every point in a mesh
+   * @param T_e view of the electron temperatures
+   * @param T_g view of the gas temperatures
+   * @param values view of where the sampled data will be stored
+   * @throws invalid_argument if the views are not all the same size
+   * @throws invalid_argument if any electron temperature is outside of the tabulated data
+   * and the extrapolation policy is ERROR
+   */
+  void sampleData(const ArrayView<const double> T_e,
+                  const ArrayView<const double> T_g,
+                  const ArrayView<double> values) const;
+  /**
+   * Samples data at many points at once with a gas temperature of zero
+   * @param T_e view of the electron temperatures
+   * @param values view of where the sampled data will be stored
+   * @throws invalid_argument if the views are not the same size
+   * @throws invalid_argument if any electron temperature is outside of the tabulated data
+   * and the extrapolation policy is ERROR
+   */
+  void sampleData(const ArrayView<const double> T_e, const ArrayView<double> values) const;
 
   std::string to_string() const;
 
@@ -217,6 +399,26 @@ private:
   /** SpeciesFactor is a friend so that it can access the species in this reaction */
   friend class SpeciesFactory;
   friend class NetworkParser;
+  /**
+   * Restores a reaction from data written with serialize() without any validation
+   * the species data is not restored, setSpeciesData() must be called once the species are indexed
+   * @param in the reader positioned at the start of the data
+   * @param species the species in the network in id order
+   */
+  Reaction(BinaryReader & in, const std::vector<std::shared_ptr<Species>> & species);
+  /**
+   * Writes all of the data held by the reaction so that it can be restored later
+   * species are written by their ids so the species must be indexed first
+   */
+  void serialize(BinaryWriter & out) const;
+  /**
+   * Get the stoiciometric coefficient for a species in this reaction by its symbol
+   * @throws invalid_argument if the species is not in this reaction
+   */
+  int getStoicCoeffBySymbol(const SymbolId symbol) const;
+  /** Restores a list of species written by serialize() */
+  static std::vector<std::weak_ptr<Species>>
+  readSpecies(BinaryReader & in, const std::vector<std::shared_ptr<Species>> & species);
   /** helper to make sure the reaction exprssion is at least acceptable without
    * checking it too hard
    * @param throws InvalidReaction if the reaction does not contain '->'
@@ -226,22 +428,28 @@ private:
   /**
    * Helper method for getting and removing the coefficient
    * of a species in the reaction
+   * @param s the species with its coefficient, the coefficient is removed from the view
+   * @throws InvalidReaction if the coefficient is not a number or there is no species after it
    */
-  unsigned int getCoeff(std::string & s);
+  unsigned int getCoeff(std::string_view & s) const;
 
   /**
    * Sets up the reactants and products for the reaction
    * calculated the stoiciometric coefficients for each species
+   * @param sf the factory which creates the species
    */
-  void setSides();
-  /** Checks to make sure the reaction is properly balanced */
-  void validateReaction();
+  void setSides(SpeciesFactory & sf);
+  /**
+   * Checks to make sure the reaction is properly balanced
+   * @param sf the factory which holds the symbols of the elements
+   */
+  void validateReaction(const SpeciesFactory & sf);
   /** Sets up the LateX for the species */
   void setLatexRepresentation();
   /** Substitutes any species in the reaction for their proper lumped representation  */
-  void substituteLumped();
+  void substituteLumped(SpeciesFactory & sf);
   /** checks to make sure the refereces provided for a reaction actually exist */
-  void checkReferences();
+  void checkReferences(BibTexHelper & bth);
   /** Makes sure we only hold on to one weak_ptr per species */
   void collectUniqueSpecies();
   /** sets up the SpeciesData with the correct Ids for species */
@@ -250,8 +458,48 @@ private:
    * interpolated between the data provided in file
    * this does not support interpolation with both parameters
    * this ignores the second parameter passed the function
+   * the extrapolation policy and counting are template parameters so that the
+   * sampler only contains the work that this reaction needs
    */
+  template <ExtrapolationPolicy policy, bool count>
   double interpolator(const double T_e, const double T_g) const;
+  /** selects the interpolator for the extrapolation policy of this reaction */
+  void setInterpolator();
+  /** binds the interpolator for a given policy to the sampler */
+  template <ExtrapolationPolicy policy>
+  void setInterpolator();
+  /** binds the function for the functional form of this reaction to the sampler */
+  void setFunctionSampler();
+  /** builds the interpolation table from the tabulated data */
+  void buildTable();
+  /**
+   * the value of a table outside of its range for a given policy
+   * @param table the table being sampled
+   * @param T_e a point outside of the table
+   */
+  template <ExtrapolationPolicy policy>
+  double extrapolate(const InterpolationTable & table, const double T_e) const;
+  /**
+   * the value of a table outside of its range for the policy of this reaction
+   * this also counts the extrapolation when requested
+   * @param table the table being sampled
+   * @param T_e a point outside of the table
+   */
+  double extrapolate(const InterpolationTable & table, const double T_e) const;
+  /** batch version of interpolator, ignores T_g */
+  void interpolateBatch(const ArrayView<const double> & T_e,
+                        const ArrayView<double> & values) const;
+  /** batch version of the arrhenius forms */
+  void evaluateFunctionBatch(const ArrayView<const double> & T_e,
+                             const ArrayView<const double> & T_g,
+                             const ArrayView<double> & values) const;
+  /**
+   * Throws the error for when data is requested outside the range of the tabulated data
+   * @param table the table that was being sampled
+   * @param T_e the electron temperature that was requested
+   */
+  [[noreturn]] void throwExtrapolationError(const InterpolationTable & table,
+                                            const double T_e) const;
   /** Evaluates the arrhenius form requested */
   double constantRate(const double T_e, const double T_g) const;
   double partialArrhenius1(const double T_e, const double T_g) const;
@@ -282,12 +530,24 @@ private:
   std::vector<std::string> _notes;
   /// the function parameters if they are provided
   std::vector<double> _params;
+  /// the functional form selected by the number of parameters provided
+  FunctionalForm _functional_form;
   /// the data from file if it is provided
   std::vector<TabulatedReactionData> _tabulated_data;
+  /// indexed copy of the tabulated data used for sampling
+  InterpolationTable _table;
+  /// the Maxwellian rate coefficient computed from the cross section, if requested
+  InterpolationTable _rate_table;
+  /// what to do when tabulated data is sampled outside of its range
+  ExtrapolationPolicy _extrapolation;
+  /// whether or not to count the samples that are outside of the range of the tabulated data
+  const bool _count_extrapolations;
+  /// the number of samples that were outside of the range of the tabulated data
+  mutable std::atomic<std::size_t> _extrapolation_count;
   /// A list of the species that exist in this reaction
   std::vector<std::weak_ptr<Species>> _species;
-  /// The stoiciometric coefficeints for this reaction
-  std::unordered_map<std::string, int> _stoic_coeffs;
+  /// The stoiciometric coefficeints for this reaction keyed on the symbols of the species
+  SymbolMap<int> _stoic_coeffs;
   /// The stoiciometric coefficients for this reaction indexed by id
   std::unordered_map<SpeciesId, int> _id_stoic_map;
   /// the LaTeX version of the symbolic expression
@@ -298,8 +558,8 @@ private:
   ///@{
   std::vector<std::weak_ptr<Species>> _reactants;
   std::vector<std::weak_ptr<Species>> _products;
-  std::unordered_map<std::string, unsigned int> _reactant_count;
-  std::unordered_map<std::string, unsigned int> _product_count;
+  SymbolMap<unsigned int> _reactant_count;
+  SymbolMap<unsigned int> _product_count;
   ///@
   /// these should also really be sets in the future
   /// for now this is annoying but it's fine
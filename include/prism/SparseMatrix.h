@@ -0,0 +1,176 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace prism
+{
+/**
+ * The two compressed storage layouts
+ * CSR stores the matrix row by row and CSC stores it column by column
+ */
+enum class SparseLayout
+{
+  CSR,
+  CSC
+};
+
+/** A single entry of a sparse matrix used to build a SparseMatrix */
+template <typename T>
+struct SparseEntry
+{
+  /// the row of the entry
+  unsigned int row;
+  /// the column of the entry
+  unsigned int col;
+  /// the value of the entry
+  T value;
+};
+
+/**
+ * A matrix in compressed sparse row (CSR) or compressed sparse column (CSC) form
+ * The outer dimension is the rows for CSR and the columns for CSC.
+ * The entries of outer index i are at positions offsets()[i] to offsets()[i + 1] of
+ * indices() and values(), and they are sorted by their inner index
+ */
+template <typename T>
+class SparseMatrix
+{
+public:
+  /** Creates an empty 0 x 0 matrix */
+  SparseMatrix() : _layout(SparseLayout::CSR), _rows(0), _cols(0), _offsets(1, 0) {}
+  /**
+   * @param rows the number of rows in the matrix
+   * @param cols the number of columns in the matrix
+   * @param entries the entries of the matrix, in any order. Entries that
+   * share the same row and column are summed
+   * @param layout how the matrix is stored
+   * @throws invalid_argument if any entry is outside of the matrix
+   */
+  SparseMatrix(const std::size_t rows,
+               const std::size_t cols,
+               std::vector<SparseEntry<T>> entries,
+               const SparseLayout layout)
+    : _layout(layout), _rows(rows), _cols(cols), _offsets(outerSize() + 1, 0)
+  {
+    for (const auto & e : entries)
+      if (e.row >= rows || e.col >= cols)
+        throw std::invalid_argument("Sparse matrix entry is outside of the matrix");
+
+    std::sort(entries.begin(),
+              entries.end(),
+              [this](const SparseEntry<T> & a, const SparseEntry<T> & b)
+              {
+                if (outer(a) != outer(b))
+                  return outer(a) < outer(b);
+                return inner(a) < inner(b);
+              });
+
+    _indices.reserve(entries.size());
+    _values.reserve(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+      const auto & e = entries[i];
+      if (i != 0 && outer(e) == outer(entries[i - 1]) && inner(e) == inner(entries[i - 1]))
+      {
+        _values.back() += e.value;
+        continue;
+      }
+      ++_offsets[outer(e) + 1];
+      _indices.push_back(inner(e));
+      _values.push_back(e.value);
+    }
+
+    for (std::size_t i = 0; i < outerSize(); ++i)
+      _offsets[i + 1] += _offsets[i];
+  }
+
+  /**
+   * The value at a row and column of the matrix
+   * @returns the value or zero if no value is stored there
+   */
+  T operator()(const std::size_t row, const std::size_t col) const
+  {
+    const std::size_t o = _layout == SparseLayout::CSR ? row : col;
+    const std::size_t i = _layout == SparseLayout::CSR ? col : row;
+    const auto begin = _indices.begin() + _offsets[o];
+    const auto end = _indices.begin() + _offsets[o + 1];
+    const auto it = std::lower_bound(begin, end, i);
+    return it != end && *it == i ? _values[it - _indices.begin()] : T(0);
+  }
+
+  /**
+   * The same matrix stored in another layout
+   * @param layout the layout of the new matrix
+   */
+  SparseMatrix<T> convert(const SparseLayout layout) const
+  {
+    std::vector<SparseEntry<T>> entries;
+    entries.reserve(nonZeros());
+    for (std::size_t o = 0; o < outerSize(); ++o)
+      for (std::size_t k = _offsets[o]; k < _offsets[o + 1]; ++k)
+      {
+        const auto o_index = static_cast<unsigned int>(o);
+        if (_layout == SparseLayout::CSR)
+          entries.push_back({o_index, _indices[k], _values[k]});
+        else
+          entries.push_back({_indices[k], o_index, _values[k]});
+      }
+    return SparseMatrix<T>(_rows, _cols, entries, layout);
+  }
+
+  /** Self descriptive getter method */
+  SparseLayout layout() const { return _layout; }
+  /** Self descriptive getter method */
+  std::size_t rows() const { return _rows; }
+  /** Self descriptive getter method */
+  std::size_t cols() const { return _cols; }
+  /** The number of stored entries */
+  std::size_t nonZeros() const { return _values.size(); }
+  /** The number of rows for CSR or the number of columns for CSC */
+  std::size_t outerSize() const { return _layout == SparseLayout::CSR ? _rows : _cols; }
+  /** Where the entries of each row (CSR) or column (CSC) begin, with outerSize() + 1 entries */
+  const std::vector<std::size_t> & offsets() const { return _offsets; }
+  /** The column (CSR) or row (CSC) of each stored entry */
+  const std::vector<unsigned int> & indices() const { return _indices; }
+  /** The value of each stored entry */
+  const std::vector<T> & values() const { return _values; }
+
+private:
+  /// how the matrix is stored
+  SparseLayout _layout;
+  /// the number of rows in the matrix
+  std::size_t _rows;
+  /// the number of columns in the matrix
+  std::size_t _cols;
+  /// where the entries for each outer index begin
+  std::vector<std::size_t> _offsets;
+  /// the inner index of each entry
+  std::vector<unsigned int> _indices;
+  /// the value of each entry
+  std::vector<T> _values;
+
+  /** the outer index of an entry for the layout of this matrix */
+  unsigned int outer(const SparseEntry<T> & e) const
+  {
+    return _layout == SparseLayout::CSR ? e.row : e.col;
+  }
+  /** the inner index of an entry for the layout of this matrix */
+  unsigned int inner(const SparseEntry<T> & e) const
+  {
+    return _layout == SparseLayout::CSR ? e.col : e.row;
+  }
+};
+}
@@ -38,6 +38,8 @@ struct ReactionData
 
 class Reaction;
 class SubSpecies;
+class SpeciesFactory;
+struct SpeciesDecomposition;
 
 /**
  * The species object which represents the products
@@ -48,9 +50,17 @@ class Species : public SpeciesBase
 public:
   /**
    * Constructor for the species based on its symbolic representation
+   * masses and latex overrides come from SpeciesFactory::instance()
    * @param name the symbol used for the species
    */
   Species(const std::string & name, const bool marked_constant = false);
+  /**
+   * Constructor for the species based on its symbolic representation
+   * @param name the symbol used for the species
+   * @param marked_constant whether or not the species was marked constant in the input
+   * @param factory the factory which provides the masses and latex overrides
+   */
+  Species(const std::string & name, const bool marked_constant, const SpeciesFactory & factory);
   /**
    * getter for the unique id for the species
    * @returns its position in the vector returned by NetworkParser::species()
@@ -237,6 +247,12 @@ public:
   }
   /** Getter method for the subspecies list */
   const std::vector<SubSpecies> & subSpecies() const { return _sub_species; }
+  /**
+   * The number of each element in the species indexed by the element ids of the factory which
+   * created it, elements past the end of the vector do not appear in the species
+   * electrons and photons are not elements, they are accounted for by the charge number
+   */
+  const std::vector<unsigned int> & composition() const { return _composition; }
 
   virtual std::string to_string() const override;
   friend std::string to_string(const std::shared_ptr<prism::Species> & s);
@@ -248,11 +264,39 @@ public:
 private:
   /// The species factory helps add reactionts to our lists
   friend class SpeciesFactory;
+  /// the parser saves and restores species in its network cache
+  friend class NetworkParser;
+  /**
+   * Restores a species from data written with serialize() without any validation
+   * the reactions the species is a part of are not restored, they are added by the factory
+   * @param in the reader positioned at the start of the data
+   * @param symbols the table the names are interned in
+   * @param elements the table which gives out the element ids
+   */
+  Species(BinaryReader & in, SymbolTable & symbols, SymbolTable & elements);
+  /** Writes the data which describes the species so that it can be restored later */
+  void serialize(BinaryWriter & out) const;
+  /** Restores the subspecies written by serialize() */
+  static std::vector<SubSpecies> readSubSpecies(BinaryReader & in, SymbolTable & symbols);
+  /**
+   * Builds the species from a decomposition that the factory has already summed
+   * @param name the symbol used for the species
+   * @param marked_constant whether or not the species was marked constant in the input
+   * @param factory the factory which provides the element ids
+   * @param decomposition the sub-species of the name and their totals
+   */
+  Species(const std::string & name,
+          const bool marked_constant,
+          const SpeciesFactory & factory,
+          const SpeciesDecomposition & decomposition);
+
   SpeciesId _id;
   /// wether or not the species is considered constant in the mechism
   const bool _marked_constant;
   /// the list of the sub_species in the the class */
   const std::vector<SubSpecies> _sub_species;
+  /// the number of each element in the species indexed by element id
+  std::vector<unsigned int> _composition;
   /** All rate based reactions */
   ///@{
   std::vector<ReactionData> _rate_based_data;
@@ -278,16 +322,23 @@ private:
   std::vector<std::weak_ptr<const Reaction>> _function_xsec_based;
   ///@}
 
-  /** Method for constructing the latex name of the species  */
-  void setLatexName() override;
   /**
    * This method breaks down the species into the various
    * different elements that are in the species
+   * species should be decomposed through SpeciesFactory::decomposeSpecies() which caches the result
+   * @param name the string representation of the species
+   * @param factory the factory which provides the masses and latex overrides
+   */
+  static std::vector<SubSpecies> decomposeSpecies(const std::string & name,
+                                                  const SpeciesFactory & factory);
+  /**
+   * Counts the elements in all of the subspecies
+   * @param elements the table which gives out the element ids
    */
-  const std::vector<SubSpecies> decomposeSpecies();
-  /** Method for getting the total mass based on all of the subspecies */
-  void setMass() override;
-  /** Method for getting the total charge number based on all of the subspecies */
+  void setComposition(SymbolTable & elements);
+  /** Takes the mass, charge number, and latex name from the totals of a decomposition */
+  void setTotals(const SpeciesDecomposition & decomposition);
+  /** Method for getting the total charge from the charge number */
   void setCharge() override;
   /** Finds the grounded neutral state of a species  */
   virtual void setNeutralGroundState() override;
@@ -12,8 +12,13 @@
 #include <string>
 #include <iostream>
 
+#include "SymbolTable.h"
+
 namespace prism
 {
+class BinaryReader;
+class BinaryWriter;
+
 /**
  * Base class for species and subspecies
  */
@@ -22,8 +27,9 @@ class SpeciesBase
 public:
   /**
    * @param name the string representation of the base
+   * @param symbols the table the name is interned in
    */
-  SpeciesBase(const std::string & name);
+  SpeciesBase(const std::string & name, SymbolTable & symbols);
   virtual ~SpeciesBase() {}
   /** Comparison operator checks if the two base species have the same name */
   bool operator==(const SpeciesBase & other) const;
@@ -31,6 +37,8 @@ public:
   bool operator!=(const SpeciesBase & other) const;
   /** Getter method for the name of species */
   const std::string & name() const { return _name; }
+  /** Getter method for the interned handle of the name of the species */
+  SymbolId symbol() const { return _symbol; }
   /**
    * Getter method for the mass of the species
    * mass of the species is in kg
@@ -55,8 +63,19 @@ public:
   virtual std::string to_string() const;
 
 protected:
+  /**
+   * Restores the base from data written with serialize() without any validation
+   * @param in the reader positioned at the start of the data
+   * @param symbols the table the name is interned in
+   */
+  SpeciesBase(BinaryReader & in, SymbolTable & symbols);
+  /** Writes all of the data held by the base so that it can be restored later */
+  void serialize(BinaryWriter & out) const;
+
   /// The full std::string of the species base
   std::string _name;
+  /// The handle of the name in the symbol table it was interned in
+  SymbolId _symbol;
   /// The mass of an individual instance of the species
   double _mass;
   /// the molar mass of the species
@@ -75,17 +94,11 @@ protected:
    * also checks to make sure e and E are reserved for electrons only
    * @param name the std::string representation of the name
    */
-  std::string checkName(const std::string & name);
-  /**
-   * Method for setting the mass of the species
-   */
-  virtual void setMass() = 0;
+  static std::string checkName(const std::string & name);
   /**
    * Method for the setting the charge number of the species
    */
   virtual void setCharge() = 0;
-  /** methods for setting the latex name of each species */
-  virtual void setLatexName() = 0;
   virtual void setNeutralGroundState() = 0;
 };
 }
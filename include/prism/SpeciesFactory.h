@@ -10,18 +10,44 @@
 //*
 #pragma once
 #include <map>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include "yaml-cpp/yaml.h"
 
 #include "Species.h"
 #include "PrismConstants.h"
+#include "SpeciesOrdering.h"
+#include "SymbolTable.h"
 
 namespace prism
 {
 class Reaction;
 class SpeciesSummaryWriterBase;
+/**
+ * The sub-species of a name, the totals summed over them, and the masses and latex overrides
+ * that were used to build them
+ */
+struct SpeciesDecomposition
+{
+  /// the sub-species in the order they appear in the name
+  std::vector<SubSpecies> sub_species;
+  /// the molar mass summed over the sub-species
+  double molar_mass;
+  /// the charge number summed over the sub-species
+  int charge_num;
+  /// the latex names of the sub-species joined together
+  std::string latex_name;
+  /// the mass of the base of each sub-species
+  std::vector<double> base_masses;
+  /// the latex override of each sub-species, empty when none was provided
+  std::vector<std::string> latex_overrides;
+  /// the mass used to remove electrons from ions
+  double electron_mass;
+};
+
 /**
  * This factory creates and stores, and passes around all of the species
  * that exist in a reaction mechanism
@@ -34,9 +60,15 @@ private:
 #else
 public:
 #endif
-  /** Static function to get the instance of the singleton */
+  /**
+   * Static function to get the instance shared by the default NetworkParser
+   * parsers created with their own constructor own a separate factory
+   */
   static SpeciesFactory & instance();
-  /** resets the factory to a state as if no reactions have been parsed */
+  /**
+   * resets the factory to a state as if no reactions have been parsed
+   * the species ordering is kept
+   */
   void clear();
   // if we are in testing mode we'll give other people access to these
   // otherwise we want them to be private
@@ -51,11 +83,21 @@ public:
    * @returns the molar mass of the species if it knows it
    */
   double getMass(const std::string & name) const;
+  /**
+   * Breaks a species name down into its sub-species and sums their mass, charge, and latex name
+   * decompositions are cached by name and a cached decomposition is reused for as long as the
+   * masses and latex overrides it was built with are unchanged, the cache survives clear()
+   * a stale decomposition is replaced rather than modified so the one returned stays valid
+   * @param name the string representation of the species
+   * @throws InvalidSpecies if the name cannot be decomposed
+   */
+  std::shared_ptr<const SpeciesDecomposition> decomposeSpecies(const std::string & name) const;
 #ifdef TESTING
 private:
 #endif
   /// friend class so the parser can call several private methods
   friend class NetworkParser;
+  friend class Species;
   friend class SubSpecies;
   friend class Reaction;
 
@@ -65,17 +107,16 @@ private:
    * @returns the latex override or an empty string if one is not provided
    */
   const std::string getLatexOverride(const std::string & name) const;
-
   /**
    * Returns a weak_ptr to a species based on its name
    * if the factory does not contain a species with this name a new one
    * will be created
    * this is the only method that should ever be used to create species
-   * objects
+   * objects, it is safe to call from several threads at once
    * @param name a string name of the species
    * @returns a weak_ptr to the species that has been created
    */
-  std::weak_ptr<Species> getSpecies(const std::string & name);
+  std::weak_ptr<Species> getSpecies(std::string_view name);
   // /**
   //  *
   //  */
@@ -86,6 +127,20 @@ private:
   }
 
   const std::vector<std::string> & speciesNames() const { return _species_names; }
+  /**
+   * Gets the id of a species from its name in constant time
+   * this is only valid after the species have been indexed
+   * @param name the name of the species
+   * @throws invalid_argument if there is no species with this name
+   */
+  SpeciesId speciesId(const std::string & name) const;
+  /** The table every species, sub-species, and element name is interned in */
+  SymbolTable & symbols() const { return _symbols; }
+  /**
+   * The element ids of the bases of every sub-species, ids are dense and never reused
+   * electrons and photons are not given element ids
+   */
+  SymbolTable & elements() const { return _elements; }
   /**
    * Method checks for lumped states of a species
    * if there is one it will return the pointer to the species the name is lumped into
@@ -97,8 +152,30 @@ private:
    * Method gives all of the species objects in the factor which are used
    * in reactions an id. they are based on the number of reactions they exist in
    * the species in the most reactions will have the lowest index
+   * unless another ordering has been selected with NetworkParser::setSpeciesOrdering()
    */
   void indexSpecies();
+  /**
+   * Removes every species which is not in any reactions
+   * the order of the remaining species is not changed
+   */
+  void removeUnusedSpecies();
+  /**
+   * Removes every reaction from the collections of all of the species
+   * so that the reactions can be added again after a network is parsed again
+   */
+  void clearReactions();
+  /**
+   * Gives every species its position in the species list as its id
+   * and rebuilds the name, index, and transient species lists
+   */
+  void assignSpeciesIds();
+  /**
+   * Reorders the species with the selected strategy, the default ordering must already
+   * be applied so that it can be used to break ties
+   * @throws invalid_argument if the user provided ordering is not valid
+   */
+  void reorderSpecies();
 
   /**
    * Adds the reaction to the species collections of reactions
@@ -113,24 +190,36 @@ private:
    */
   void addXSecBasedReaction(std::shared_ptr<const Reaction> r);
 
-  /// Stuff to ensure this is a singleton class
+  /// Only the NetworkParser creates factories and they cannot be copied
   ///@{
   SpeciesFactory();
-  // Private copy constructor and assignment operator to prevent cloning
   SpeciesFactory(const SpeciesFactory &) = delete;
   SpeciesFactory & operator=(const SpeciesFactory &) = delete;
-  // Private instance of the singleton
-  static SpeciesFactory * _instance;
-  /// the index to be assigned to the next species created
   ///@}
   /**
    * Writes a species summary to a file
    */
   void writeSpeciesSummary(const std::string & file, SpeciesSummaryWriterBase & writer) const;
+  /** Whether or not the masses and latex overrides a decomposition was built with are current */
+  bool decompositionCurrent(const SpeciesDecomposition & decomposition) const;
+
   /// the vector that holds all of the species in the mechanism
   std::vector<std::shared_ptr<Species>> _species;
-  /// the map between Species and their position in the species vector
-  std::unordered_map<std::string, SpeciesId> _species_indicies;
+  /// guards the creation of species while reactions are constructed in parallel
+  std::mutex _species_mutex;
+  /// every name that has been decomposed by this factory
+  mutable std::unordered_map<std::string, std::shared_ptr<const SpeciesDecomposition>>
+      _decompositions;
+  /// guards the decomposition cache since species can be created through a const factory
+  mutable std::mutex _decomposition_mutex;
+  /// the names of every species, sub-species, and element, interning a name does not change
+  /// the factory so it can be done through a const reference
+  mutable SymbolTable _symbols;
+  /// the elements which make up the species, the symbols are used as element ids
+  mutable SymbolTable _elements;
+  /// the position of every species in the species vector indexed by the symbol of its name
+  /// symbols which do not belong to a species hold NO_SPECIES
+  std::vector<SpeciesId> _species_indicies;
   /// the list of all of the names of species
   /// this is only filled after indexSpecies() has been called.
   std::vector<std::string> _species_names;
@@ -143,6 +232,10 @@ private:
   std::set<std::string> _constant_species;
   /// the map of species names to latex overrides
   std::unordered_map<std::string, std::string> _latex_overrides;
+  /// the strategy used to assign the species ids
+  SpeciesOrdering _ordering;
+  /// the species names in the order requested by the user
+  std::vector<std::string> _user_ordering;
   /// the mass of every species on the periodic table
   /// these are molar masses in g / mol
   std::unordered_map<std::string, double> _default_masses = {{"hnu", 0.0},
@@ -0,0 +1,54 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace prism
+{
+/**
+ * The strategies for assigning species ids
+ * every strategy places the transient species before the constant species
+ */
+enum class SpeciesOrdering
+{
+  /// species in the most reactions first, ties are broken by name
+  DEFAULT,
+  /// reverse Cuthill-McKee ordering of the species coupling graph, reduces the bandwidth
+  REVERSE_CUTHILL_MCKEE,
+  /// minimum degree ordering of the species coupling graph, reduces fill in LU factorizations
+  MINIMUM_DEGREE,
+  /// the order of a list of species names provided by the user
+  USER
+};
+
+/**
+ * Computes the reverse Cuthill-McKee ordering of a graph
+ * Each connected component is started from its lowest degree node and
+ * neighbors are visited from the lowest to highest degree, ties are broken by node index
+ * @param offsets where the neighbors of each node begin, with one more entry than nodes
+ * @param neighbors the neighbors of every node, the graph must be symmetric
+ * @returns the nodes in their new order
+ */
+std::vector<unsigned int> reverseCuthillMcKee(const std::vector<std::size_t> & offsets,
+                                              const std::vector<unsigned int> & neighbors);
+/**
+ * Computes a minimum degree ordering of a graph
+ * Nodes are eliminated one at a time, always picking the node with the fewest
+ * neighbors in the elimination graph, ties are broken by node index
+ * @param offsets where the neighbors of each node begin, with one more entry than nodes
+ * @param neighbors the neighbors of every node, the graph must be symmetric
+ * @returns the nodes in their new order
+ */
+std::vector<unsigned int> minimumDegree(const std::vector<std::size_t> & offsets,
+                                        const std::vector<unsigned int> & neighbors);
+}
@@ -10,6 +10,7 @@
 //*
 #pragma once
 
+#include <ostream>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -18,6 +19,7 @@
 
 namespace prism
 {
+class NetworkParser;
 
 class SpeciesSummaryWriterBase
 {
@@ -29,7 +31,7 @@ public:
    * several methods of this type get called when
    * NetworkParser::writeSpeciesSummary() gets called
    */
-  SpeciesSummaryWriterBase() {}
+  SpeciesSummaryWriterBase() : _sink(nullptr), _network(nullptr) {}
   /**
    * clears the state of the writer to begin a new file
    */
@@ -41,8 +43,27 @@ public:
 
   /*
    * Getter method for the summary string
+   * when a sink is set this only holds what has been written since the last flush()
    */
   std::ostringstream & summaryString() { return _summary_str; }
+  /**
+   * Sets the stream that flush() moves the summary into
+   * @param sink the stream the summary is written to, nullptr keeps the whole summary in memory
+   */
+  void setSink(std::ostream * sink) { _sink = sink; }
+  /**
+   * Moves everything written so far into the sink so that only a small piece of
+   * the summary is ever held in memory, does nothing when there is no sink
+   */
+  void flush()
+  {
+    if (!_sink)
+      return;
+
+    *_sink << _summary_str.str();
+    _summary_str.str("");
+    _summary_str.clear();
+  }
   /**
    * Method for adding any random summaries to the top of the summary file
    */
@@ -59,6 +80,20 @@ public:
 protected:
   /// the stream that is used to construct the summary
   std::ostringstream _summary_str;
+  /// where the summary is flushed to, the summary is only kept in memory when this is null
+  std::ostream * _sink;
+  /**
+   * The parser whose species are being summarized
+   * this is the default NetworkParser::instance() unless the summary is being
+   * written by another parser
+   */
+  const NetworkParser & network() const;
+
+private:
+  /// the NetworkParser is a friend so that it can set the network being summarized
+  friend class NetworkParser;
+  /// the parser whose species are being summarized while a summary is written
+  const NetworkParser * _network;
 };
 
 }
@@ -0,0 +1,44 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include "SparseMatrix.h"
+
+namespace prism
+{
+/**
+ * A matrix with a row for every reaction (indexed by reaction id) and a column for
+ * every species (indexed by species id), stored both row by row and column by column
+ * The CSR form gives the species of each reaction and the CSC form gives the reactions
+ * of each species
+ */
+struct StoichiometricMatrix
+{
+  /// the matrix stored row by row
+  SparseMatrix<int> csr;
+  /// the matrix stored column by column
+  SparseMatrix<int> csc;
+};
+
+/**
+ * The stoichiometric matrices for a block of reactions
+ * zero entries are never stored
+ */
+struct StoichiometricMatrices
+{
+  /// the net stoichiometric coefficient (products - reactants) of each species in each reaction
+  StoichiometricMatrix net;
+  /// the number of times each species appears as a reactant, the reaction order of the species
+  StoichiometricMatrix reactant;
+  /// the number of times each species appears as a product
+  StoichiometricMatrix product;
+};
+}
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
@@ -37,6 +38,58 @@ void rtrim(std::string & s);
  */
 void trim(std::string & s);
 
+/**
+ * Trim the white space from the left end of a view, nothing is copied
+ * @param s the view to trim
+ * @returns a view of s without the leading white space
+ */
+std::string_view ltrimView(std::string_view s);
+
+/**
+ * Trim the white space from the right end of a view, nothing is copied
+ * @param s the view to trim
+ * @returns a view of s without the trailing white space
+ */
+std::string_view rtrimView(std::string_view s);
+
+/**
+ * Trim the white space from both ends of a view, nothing is copied
+ * @param s the view to trim
+ * @returns a view of s without white space on either end
+ */
+std::string_view trimView(std::string_view s);
+
+/**
+ * Walks through the pieces of a string seperated by a delimiter without
+ * allocating anything, every piece is trimmed of white space
+ * Ex: "A + B -> C + D" with delimiter " -> " provides "A + B" and then "C + D"
+ * The string being split must outlive the tokenizer and the pieces it provides
+ */
+class Tokenizer
+{
+public:
+  /**
+   * @param s the string that will be split into pieces
+   * @param d the delimiter that will be used to split the string
+   */
+  Tokenizer(std::string_view s, std::string_view d) : _rest(s), _delimiter(d), _done(false) {}
+
+  /**
+   * Provides the next piece of the string
+   * @param token set to the next piece when there is one
+   * @returns false once every piece has been provided
+   */
+  bool next(std::string_view & token);
+
+private:
+  /// the part of the string which has not been split yet
+  std::string_view _rest;
+  /// the string which seperates the pieces
+  std::string_view _delimiter;
+  /// whether or not the last piece has been provided
+  bool _done;
+};
+
 /**
  * Break a given std::string into pieces based on the provided delimieter
  * This will not modified the value of std::string s
@@ -48,6 +101,15 @@ void trim(std::string & s);
  */
 std::vector<std::string> splitByDelimiter(const std::string & s, const std::string & d);
 
+/**
+ * Removes the coefficient from the front of a species in a reaction expression
+ * Ex: "2Ar" becomes "Ar" and 2 is returned, "Ar" is left alone and 1 is returned
+ * @param s the species with its coefficient, the coefficient is removed from the view
+ * @throws invalid_argument if the coefficient is not a number or there is no species after it
+ * @returns the coefficient of the species
+ */
+unsigned int takeCoefficient(std::string_view & s);
+
 /**
  * Find the first capital letter in a std::string
  * @param s the std::string to search
@@ -128,6 +190,13 @@ void printGreen(const std::string & s);
  */
 void printRed(const std::string & s);
 
+/**
+ * Method add the yellow escape color to the std::string and prints
+ * to standard output
+ * @param s the std::string to print in yellow
+ */
+void printYellow(const std::string & s);
+
 /**
  * Adds the green escape color to the front of a std::string and
  * then adds the default color escape color the end of it so
@@ -144,6 +213,14 @@ std::string makeGreen(const std::string & s);
  */
 std::string makeRed(const std::string & s);
 
+/**
+ * Adds the yellow escape color to the front of a std::string and
+ * then adds the default color escape color the end of it so
+ * no other text color is changed
+ * @param s the std::string to add the characters to
+ */
+std::string makeYellow(const std::string & s);
+
 /**
  * Colleces data from files which have columns of data seperated by a
  * delimiter
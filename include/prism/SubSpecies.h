@@ -14,10 +14,10 @@
 
 #include "SpeciesBase.h"
 
-class SpeciesFactory;
-
 namespace prism
 {
+class SpeciesFactory;
+
 /**
  * The parts with a Species can be brokenup into
  * Eg Speices: NH3, SubSpecies: [N, H3]
@@ -27,9 +27,16 @@ class SubSpecies : public SpeciesBase
 public:
   /**
    * Creates a simple SubSpecies object
+   * masses and latex overrides come from SpeciesFactory::instance()
    * @param name the string representation of the subspecies
    */
   SubSpecies(const std::string & name);
+  /**
+   * Creates a simple SubSpecies object
+   * @param name the string representation of the subspecies
+   * @param factory the factory which provides the masses and latex overrides
+   */
+  SubSpecies(const std::string & name, const SpeciesFactory & factory);
 
   /** Comparison operator checks if the sub species have the same member variables */
   bool operator==(const SubSpecies & other) const;
@@ -38,6 +45,8 @@ public:
 
   /** getter method for the elemental base of the species */
   const std::string & base() const { return _base; }
+  /** getter method for the interned handle of the elemental base of the species */
+  SymbolId baseSymbol() const { return _base_symbol; }
   /** getter method for the modifier std::string */
   const std::string & modifier() const { return _modifier; }
   /** getter method for the subscript on the subspecies */
@@ -51,8 +60,21 @@ public:
   friend std::ostream & operator<<(std::ostream & os, const prism::SubSpecies & s);
 
 private:
+  /// species restore their subspecies when they are loaded from a cache
+  friend class Species;
+  /**
+   * Restores a subspecies from data written with serialize() without any validation
+   * @param in the reader positioned at the start of the data
+   * @param symbols the table the names are interned in
+   */
+  SubSpecies(BinaryReader & in, SymbolTable & symbols);
+  /** Writes all of the data held by the subspecies so that it can be restored later */
+  void serialize(BinaryWriter & out) const;
+
   /** This will be just the elemental name */
   const std::string _base;
+  /** The handle of the elemental name */
+  const SymbolId _base_symbol;
   /** The rest of name after the elemental name that has been removed */
   std::string _modifier;
   /** The subscript of the number ex: Ar2 this is 2 */
@@ -71,14 +93,18 @@ private:
   /**
    * Method for setting the mass of the subspecies based on the
    * subscript and elemental mass
+   * @param factory the factory which provides the masses
    */
-  void setMass() override;
+  void setMass(const SpeciesFactory & factory);
   /**
    * Method for setting the charge number of the species base
    */
   void setCharge() override;
-  /** Method for setting the latex name of the species */
-  void setLatexName() override;
+  /**
+   * Method for setting the latex name of the species
+   * @param factory the factory which provides the latex overrides
+   */
+  void setLatexName(const SpeciesFactory & factory);
 
   virtual void setNeutralGroundState() override;
 };
@@ -0,0 +1,123 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace prism
+{
+/// a compact handle for a name which has been interned in a SymbolTable
+typedef uint32_t SymbolId;
+/// the handle returned when a name has not been interned
+const SymbolId INVALID_SYMBOL = std::numeric_limits<SymbolId>::max();
+
+/**
+ * Interns the names of species, sub-species, and elements into integer handles
+ * so that they can be hashed and compared without touching the strings again
+ * Names are never removed so a handle stays valid for the lifetime of the table.
+ * Names can be interned and looked up from several threads at once
+ */
+class SymbolTable
+{
+public:
+  SymbolTable() {}
+  SymbolTable(const SymbolTable &) = delete;
+  SymbolTable & operator=(const SymbolTable &) = delete;
+
+  /**
+   * Gets the handle of a name, the name is added to the table if it is not already in it
+   * @param name the name to intern
+   */
+  SymbolId intern(const std::string_view name);
+  /**
+   * Gets the handle of a name without adding it to the table
+   * @param name the name to look up
+   * @returns the handle or INVALID_SYMBOL if the name has not been interned
+   */
+  SymbolId find(const std::string_view name) const;
+  /**
+   * Gets the name of a handle
+   * @param symbol a handle given out by this table
+   * @throws invalid_argument if the handle was not given out by this table
+   */
+  const std::string & name(const SymbolId symbol) const;
+  /** The number of names in the table */
+  std::size_t size() const;
+
+private:
+  /// guards the table while names are interned on several threads
+  mutable std::shared_mutex _mutex;
+  /// the names in handle order, a deque never moves its entries so the views below stay valid
+  std::deque<std::string> _names;
+  /// the handle of every name, the keys view the strings in _names
+  std::unordered_map<std::string_view, SymbolId> _symbols;
+};
+
+/**
+ * A map keyed on symbols for the handful of entries a single reaction holds
+ * entries are stored in a flat vector in the order they were inserted, which is faster than
+ * hashing for small maps and makes iteration deterministic
+ */
+template <typename T>
+class SymbolMap
+{
+public:
+  typedef std::pair<SymbolId, T> value_type;
+  typedef typename std::vector<value_type>::iterator iterator;
+  typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+  iterator begin() { return _entries.begin(); }
+  iterator end() { return _entries.end(); }
+  const_iterator begin() const { return _entries.begin(); }
+  const_iterator end() const { return _entries.end(); }
+  std::size_t size() const { return _entries.size(); }
+  bool empty() const { return _entries.empty(); }
+  void reserve(const std::size_t size) { _entries.reserve(size); }
+
+  iterator find(const SymbolId key)
+  {
+    return std::find_if(begin(), end(), [key](const value_type & e) { return e.first == key; });
+  }
+  const_iterator find(const SymbolId key) const
+  {
+    return std::find_if(begin(), end(), [key](const value_type & e) { return e.first == key; });
+  }
+  std::size_t count(const SymbolId key) const { return find(key) == end() ? 0 : 1; }
+  /** Access to the value of a key, a default value is inserted if the key is not in the map */
+  T & operator[](const SymbolId key)
+  {
+    auto it = find(key);
+    if (it != end())
+      return it->second;
+    return _entries.emplace_back(key, T()).second;
+  }
+  /** Removes a key from the map, the order of the remaining entries is unchanged */
+  void erase(const SymbolId key)
+  {
+    auto it = find(key);
+    if (it != end())
+      _entries.erase(it);
+  }
+
+private:
+  /// the entries in insertion order
+  std::vector<value_type> _entries;
+};
+}
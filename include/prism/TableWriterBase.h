@@ -10,6 +10,7 @@
 //*
 #pragma once
 
+#include <ostream>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -28,7 +29,7 @@ public:
    * if this number is exceeded a new table is started
    */
   TableWriterBase(unsigned int max_rows = 32)
-    : _max_rows_per_table(max_rows), _rxn_count(0), _note_count(0)
+    : _max_rows_per_table(max_rows), _rxn_count(0), _note_count(0), _sink(nullptr)
   {
   }
 
@@ -50,8 +51,27 @@ public:
   unsigned int maxRows() { return _max_rows_per_table; }
   /**
    * Getter method for the stream to actually write the summary to file
+   * when a sink is set this only holds what has been written since the last flush()
    */
   std::ostringstream & tableString() { return _table_str; }
+  /**
+   * Sets the stream that flush() moves the table into
+   * @param sink the stream the table is written to, nullptr keeps the whole table in memory
+   */
+  void setSink(std::ostream * sink) { _sink = sink; }
+  /**
+   * Moves everything written so far into the sink so that only a single table
+   * is ever held in memory, does nothing when there is no sink
+   */
+  void flush()
+  {
+    if (!_sink)
+      return;
+
+    *_sink << _table_str.str();
+    _table_str.str("");
+    _table_str.clear();
+  }
   /**
    * Adds the document preamble to start of the latex doc
    */
@@ -114,6 +134,8 @@ protected:
   unsigned int _note_count;
   /// the string stream that is used to created the summary
   std::ostringstream _table_str;
+  /// where the table is flushed to, the table is only kept in memory when this is null
+  std::ostream * _sink;
   /// helper mappings between notes and their corrisponding numbering
   ///@{
   std::map<std::string, unsigned int> _note_numbers;
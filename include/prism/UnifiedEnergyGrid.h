@@ -0,0 +1,109 @@
+//* This file is a part of PRISM: Plasma Reaction Input SysteM,
+//* A library for parcing chemical reaction networks for plasma chemistry
+//* https://github.com/NCSU-ComPS-Group/prism
+//*
+//* Licensed under MIT, please see LICENSE for details
+//* https://opensource.org/license/mit
+//*
+//* Copyright 2024, North Carolina State University
+//* ALL RIGHTS RESERVED
+//*
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "PrismConstants.h"
+#include "InterpolationTable.h"
+
+namespace prism
+{
+class Reaction;
+
+/**
+ * The data from many tabulated reactions resampled onto a single energy grid
+ * The grid is the union of the energies of every reaction so no information is lost,
+ * and the values are stored as a matrix with one row per energy and one column per reaction.
+ * A single search for the bracketing energies then provides the interpolation
+ * weight for every reaction and each reaction is sampled with a multiply-add
+ * on two contiguous rows of the matrix.
+ * Reactions are zero outside of the range of their own data, this is the
+ * expected behavior for cross sections below their threshold energy
+ */
+class UnifiedEnergyGrid
+{
+public:
+  /**
+   * The location of a point on the grid
+   * the value of a reaction at the point is row[index] + weight * (row[index + 1] - row[index])
+   */
+  struct Bracket
+  {
+    /// the index of the grid point at or below the requested energy
+    std::size_t index;
+    /// the relative position of the requested energy between the two grid points
+    double weight;
+  };
+
+  /**
+   * @param rxns the reactions to merge, typically the list provided
+   * by NetworkParser::tabulatedXSecReactions()
+   * @throws invalid_argument if any of the reactions do not have tabulated data
+   */
+  UnifiedEnergyGrid(const std::vector<std::shared_ptr<const Reaction>> & rxns);
+
+  /**
+   * Finds the grid points which surround T_e
+   * @param T_e the electron energy
+   * @throws invalid_argument if T_e is outside of the grid
+   */
+  Bracket bracket(const double T_e) const;
+  /**
+   * Samples all of the reactions at the electron energy T_e
+   * values are placed in the position of the reaction id, positions in the vector
+   * which belong to other reactions are not modified
+   * the vector will be resized if it is not large enough to hold every reaction id
+   * @param T_e the electron energy
+   * @param values where the sampled values are stored
+   */
+  void sample(const double T_e, std::vector<double> & values) const;
+  /**
+   * Samples all of the reactions at the electron energy T_e
+   * values are stored contiguously in the order provided by reactionIds()
+   * @param T_e the electron energy
+   * @param values pointer to the start of an array with at least size() entries
+   */
+  void samplePacked(const double T_e, double * values) const;
+  /**
+   * Samples all of the reactions at a location that has already been found
+   * @param b the result of bracket()
+   * @param values pointer to the start of an array with at least size() entries
+   */
+  void samplePacked(const Bracket & b, double * values) const;
+
+  /** The number of reactions on the grid */
+  std::size_t size() const { return _ids.size(); }
+  /** The number of energies in the grid */
+  std::size_t numPoints() const { return _index.size(); }
+  /** The energies of the grid in ascending order */
+  const std::vector<double> & energies() const { return _index.energies(); }
+  /** The ids of the reactions in the order of the columns of the matrix */
+  const std::vector<ReactionId> & reactionIds() const { return _ids; }
+  /**
+   * The values of every reaction at a single grid point
+   * @param point the index of the grid point
+   * @returns pointer to the start of a row with size() entries
+   */
+  const double * row(const std::size_t point) const { return _values.data() + point * size(); }
+
+private:
+  /// the reaction ids in column order
+  std::vector<ReactionId> _ids;
+  /// the largest reaction id on the grid plus one
+  std::size_t _max_id;
+  /// the grid energies, only used for searching
+  InterpolationTable _index;
+  /// the values of every reaction stored row by row
+  std::vector<double> _values;
+};
+}
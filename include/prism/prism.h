@@ -12,7 +12,21 @@
 
 #include "NetworkParser.h"
 #include "Reaction.h"
+#include "FunctionRateEvaluator.h"
+#include "SparseMatrix.h"
+#include "StoichiometricMatrix.h"
+#include "CompositionMatrix.h"
+#include "MassActionKernel.h"
+#include "JacobianColoring.h"
+#include "SpeciesOrdering.h"
+#include "CompiledNetwork.h"
 #include "Species.h"
 #include "SubSpecies.h"
+#include "SymbolTable.h"
 #include "StringHelper.h"
+#include "DataFileReader.h"
 #include "InvalidInput.h"
+#include "ArrayView.h"
+#include "InterpolationTable.h"
+#include "UnifiedEnergyGrid.h"
+#include "MaxwellianRates.h"